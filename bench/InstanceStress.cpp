@@ -0,0 +1,147 @@
+/*
+  ==============================================================================
+
+    InstanceStress.cpp
+    Author:  tiagolr
+
+    Runs K processor instances concurrently on a thread pool, one block per
+    instance per round, like a host spreading plugins across cores.
+    Every instance also edits, copies and pastes its patterns and switches
+    pattern from its processing thread, so the shared ID counters and clipboard
+    are hit from all threads. Build with -DENABLE_TSAN=ON to catch data races.
+    Reports the time per round for one instance and for K, and the scaling.
+    Usage: InstanceStress [instances] [rounds] [blocksize]
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include <random>
+#include <iostream>
+#include <iomanip>
+#include "PluginProcessor.h"
+
+namespace
+{
+    struct Instance
+    {
+        std::unique_ptr<FILTRAudioProcessor> processor;
+        AudioBuffer<float> buffer;
+        MidiBuffer midi;
+        std::mt19937 rng;
+        int block = 0;
+
+        void process()
+        {
+            std::uniform_real_distribution<float> noise(-1.0f, 1.0f);
+            for (int ch = 0; ch < buffer.getNumChannels(); ++ch) {
+                auto* data = buffer.getWritePointer(ch);
+                for (int i = 0; i < buffer.getNumSamples(); ++i)
+                    data[i] = noise(rng) * 0.5f;
+            }
+
+            // pattern edits from the processing thread allocate point and version IDs concurrently
+            std::uniform_real_distribution<double> dist(0.0, 1.0);
+            auto* pattern = processor->pattern;
+            auto x = dist(rng);
+            pattern->insertPoint(x, dist(rng), 0.0, 1);
+            pattern->removePointsInRange(x - 0.001, x + 0.001);
+            if (block % 8 == 0) {
+                pattern->copy();
+                pattern->paste();
+                pattern->buildSegments();
+            }
+            if (block % 64 == 0)
+                processor->queuePattern(1 + (block / 64) % 12);
+
+            midi.clear();
+            processor->processBlock(buffer, midi);
+            ++block;
+        }
+    };
+
+    // processes one block of every instance on the pool and waits for all of them
+    double runRounds(ThreadPool& pool, std::vector<Instance>& instances, int count, int rounds)
+    {
+        std::atomic<int> pending = 0;
+        WaitableEvent done;
+
+        auto start = Time::getHighResolutionTicks();
+        for (int r = 0; r < rounds; ++r) {
+            pending.store(count);
+            for (int i = 0; i < count; ++i) {
+                pool.addJob([&instance = instances[(size_t)i], &pending, &done] {
+                    instance.process();
+                    if (pending.fetch_sub(1) == 1)
+                        done.signal();
+                });
+            }
+            done.wait();
+        }
+        auto end = Time::getHighResolutionTicks();
+        return Time::highResolutionTicksToSeconds(end - start) * 1000.0 / std::max(1, rounds);
+    }
+
+    class StressThread : public Thread
+    {
+    public:
+        StressThread(std::vector<Instance>& i, int r) : Thread("InstanceStress"), instances(i), rounds(r) {}
+
+        void run() override
+        {
+            auto count = (int)instances.size();
+            ThreadPool pool(std::max(1, std::min(count, SystemStats::getNumCpus())));
+
+            auto single = runRounds(pool, instances, 1, rounds);
+            auto all = runRounds(pool, instances, count, rounds);
+            auto speedup = single * count / std::max(1e-9, all);
+
+            std::cout << std::fixed << std::setprecision(4)
+                << "1 instance:   " << single << " ms/round\n"
+                << count << " instances: " << all << " ms/round\n"
+                << std::setprecision(2)
+                << "scaling:      " << speedup << "x on " << pool.getNumThreads() << " threads ("
+                << speedup / pool.getNumThreads() * 100.0 << "% efficiency)\n";
+
+            MessageManager::getInstance()->stopDispatchLoop();
+        }
+
+    private:
+        std::vector<Instance>& instances;
+        int rounds;
+    };
+}
+
+int main(int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juce;
+    int count = argc > 1 ? std::max(1, std::atoi(argv[1])) : 16;
+    int rounds = argc > 2 ? std::max(1, std::atoi(argv[2])) : 1000;
+    int blockSize = argc > 3 ? std::max(16, std::atoi(argv[3])) : 512;
+    const double srate = 48000.0;
+
+    // instances are created on the message thread, processing runs on the pool
+    // while this thread keeps dispatching the async calls the instances post
+    std::vector<Instance> instances((size_t)count);
+    for (int i = 0; i < count; ++i) {
+        auto& instance = instances[(size_t)i];
+        instance.processor = std::make_unique<FILTRAudioProcessor>();
+        instance.processor->setRateAndBufferSizeDetails(srate, blockSize);
+        instance.processor->prepareToPlay(srate, blockSize);
+        auto channels = std::max(instance.processor->getTotalNumInputChannels(), instance.processor->getTotalNumOutputChannels());
+        instance.buffer.setSize(std::max(2, channels), blockSize);
+        instance.rng.seed((unsigned)i + 1);
+    }
+
+    std::cout << count << " instances, " << rounds << " rounds of " << blockSize << " samples\n";
+
+    StressThread stress(instances, rounds);
+    stress.startThread();
+    MessageManager::getInstance()->runDispatchLoop();
+    stress.stopThread(-1);
+
+    for (auto& instance : instances)
+        instance.processor->releaseResources();
+    instances.clear();
+    return 0;
+}
@@ -0,0 +1,92 @@
+/*
+  ==============================================================================
+
+    PatternBench.cpp
+    Author:  tiagolr
+
+    Times pattern edits on dense patterns, 1k to 100k points
+    Usage: PatternBench [iterations]
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include <random>
+#include <iostream>
+#include <iomanip>
+#include "dsp/Pattern.h"
+
+namespace
+{
+    template <typename Fn>
+    double timeMillis(int iterations, Fn&& fn)
+    {
+        auto start = Time::getHighResolutionTicks();
+        for (int i = 0; i < iterations; ++i)
+            fn(i);
+        auto end = Time::getHighResolutionTicks();
+        return Time::highResolutionTicksToSeconds(end - start) * 1000.0 / std::max(1, iterations);
+    }
+
+    std::vector<PPoint> randomPoints(std::mt19937& rng, int count)
+    {
+        std::uniform_real_distribution<double> dist(0.0, 1.0);
+        std::vector<PPoint> pts((size_t)count);
+        for (auto& p : pts)
+            p = { 0, dist(rng), dist(rng), 0.0, 1 };
+        return pts;
+    }
+
+    void report(const char* name, int points, double millis)
+    {
+        std::cout << std::left << std::setw(22) << name
+            << std::right << std::setw(8) << points
+            << std::setw(14) << std::fixed << std::setprecision(4) << millis << " ms\n";
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juce;
+    int iterations = argc > 1 ? std::max(1, std::atoi(argv[1])) : 100;
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<double> dist(0.0, 1.0);
+
+    std::cout << std::left << std::setw(22) << "op" << std::right << std::setw(8) << "points" << std::setw(17) << "per op\n";
+
+    for (int size : { 1000, 10000, 100000 }) {
+        Pattern pattern(0);
+        auto pts = randomPoints(rng, size);
+
+        report("insertPoints batch", size, timeMillis(1, [&](int) {
+            pattern.clear();
+            pattern.insertPoints(pts);
+        }));
+
+        report("insertPoint", size, timeMillis(iterations, [&](int) {
+            pattern.insertPoint(dist(rng), dist(rng), 0.0, 1);
+        }));
+
+        report("removePointsInRange", size, timeMillis(iterations, [&](int) {
+            auto x = dist(rng);
+            pattern.removePointsInRange(x, x + 0.0001);
+        }));
+
+        report("buildSegments", size, timeMillis(10, [&](int) { pattern.buildSegments(); }));
+
+        report("get_y_at x1024", size, timeMillis(10, [&](int) {
+            double sum = 0.0;
+            for (int i = 0; i < 1024; ++i)
+                sum += pattern.get_y_at(i / 1024.0);
+            juce::ignoreUnused(sum);
+        }));
+
+        report("rotate", size, timeMillis(10, [&](int) { pattern.rotate(0.1); }));
+        report("invert", size, timeMillis(10, [&](int) { pattern.invert(); }));
+        report("reverse", size, timeMillis(10, [&](int) { pattern.reverse(); }));
+        report("doublePattern", size, timeMillis(1, [&](int) { pattern.doublePattern(); }));
+        std::cout << "\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,186 @@
+/*
+  ==============================================================================
+
+    UIBench.cpp
+    Author:  tiagolr
+
+    Renders the editor and its view into offscreen images at 1x, 1.5x and 2x
+    with patterns of 10 to 10000 points, plain, with every point multiselected
+    and with the sequencer open. Reports ms/frame and allocations/frame, the
+    allocations are counted by the global operator new of this executable.
+    Usage: UIBench [frames]
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include <random>
+#include <iostream>
+#include <iomanip>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include "PluginProcessor.h"
+#include "PluginEditor.h"
+
+static std::atomic<uint64_t> allocations { 0 };
+
+void* operator new(std::size_t size)
+{
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (auto* ptr = std::malloc(size == 0 ? 1 : size))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+namespace
+{
+    enum Overlay {
+        NoOverlay,
+        SelectOverlay, // every point multiselected
+        SeqOverlay, // sequencer open
+        kNumOverlays
+    };
+
+    const char* overlayNames[kNumOverlays] = { "none", "multiselect", "sequencer" };
+
+    struct Config {
+        int points;
+        int overlay;
+    };
+
+    /*
+        Steps through the configs on the message thread, the UI mode changes are async
+        so each config is applied over a few timer ticks before it is rendered
+    */
+    class Runner : private Timer
+    {
+    public:
+        Runner(FILTRAudioProcessor& p, AudioProcessorEditor& e, View& v, int f)
+            : processor(p), editor(e), view(v), frames(f)
+        {
+            for (int points : { 10, 100, 1000, 10000 })
+                for (int overlay = 0; overlay < kNumOverlays; ++overlay)
+                    configs.push_back({ points, overlay });
+
+            std::cout << std::left << std::setw(8) << "target" << std::setw(13) << "overlay"
+                << std::right << std::setw(8) << "points" << std::setw(7) << "scale"
+                << std::setw(13) << "ms/frame" << std::setw(13) << "allocs/frame\n";
+            startTimer(20);
+        }
+
+    private:
+        FILTRAudioProcessor& processor;
+        AudioProcessorEditor& editor;
+        View& view;
+        int frames;
+        std::vector<Config> configs;
+        size_t index = 0;
+        int step = 0;
+        std::mt19937 rng { 1234 };
+
+        void timerCallback() override
+        {
+            if (index >= configs.size()) {
+                stopTimer();
+                MessageManager::getInstance()->stopDispatchLoop();
+                return;
+            }
+
+            auto& config = configs[index];
+            if (step == 0) {
+                // the sequencer restores its pattern on close, leave it before loading the points
+                view.setSelectAll(false);
+                processor.setUIMode(UIMode::Normal);
+            }
+            else if (step == 1) {
+                std::uniform_real_distribution<double> dist(0.0, 1.0);
+                std::vector<PPoint> pts((size_t)config.points);
+                for (auto& p : pts)
+                    p = { 0, dist(rng), dist(rng), 0.0, 1 };
+
+                auto* pattern = processor.viewPattern;
+                pattern->clear();
+                pattern->insertPoints(pts);
+                pattern->buildSegments();
+                if (config.overlay == SeqOverlay)
+                    processor.setUIMode(UIMode::Seq);
+            }
+            else {
+                if (config.overlay == SelectOverlay)
+                    view.setSelectAll(true);
+                render("view", view, config);
+                render("editor", editor, config);
+                ++index;
+                step = 0;
+                return;
+            }
+            ++step;
+        }
+
+        void render(const char* target, Component& comp, const Config& config)
+        {
+            for (auto scale : { 1.f, 1.5f, 2.f }) {
+                auto width = roundToInt(comp.getWidth() * scale);
+                auto height = roundToInt(comp.getHeight() * scale);
+                if (width <= 0 || height <= 0)
+                    continue;
+
+                // one image per scale, like a cached backing store, so the frames measure painting only
+                Image image(Image::ARGB, width, height, true);
+                auto allocsBefore = allocations.load();
+                auto start = Time::getHighResolutionTicks();
+                for (int i = 0; i < frames; ++i) {
+                    Graphics g(image);
+                    g.addTransform(AffineTransform::scale(scale));
+                    comp.paintEntireComponent(g, false);
+                }
+                auto millis = Time::highResolutionTicksToSeconds(Time::getHighResolutionTicks() - start) * 1000.0;
+                auto allocs = allocations.load() - allocsBefore;
+
+                std::cout << std::left << std::setw(8) << target << std::setw(13) << overlayNames[config.overlay]
+                    << std::right << std::setw(8) << config.points << std::setw(7) << std::fixed << std::setprecision(1) << scale
+                    << std::setw(13) << std::setprecision(4) << millis / frames
+                    << std::setw(12) << std::setprecision(1) << (double)allocs / frames << "\n";
+            }
+        }
+    };
+}
+
+int main(int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juce;
+    int frames = argc > 1 ? std::max(1, std::atoi(argv[1])) : 30;
+
+    auto processor = std::make_unique<FILTRAudioProcessor>();
+    std::unique_ptr<AudioProcessorEditor> editor(processor->createEditorIfNeeded());
+
+    View* view = nullptr;
+    for (auto* child : editor->getChildren())
+        if (auto* v = dynamic_cast<View*>(child))
+            view = v;
+
+    if (view == nullptr) {
+        std::cerr << "view not found\n";
+        return 1;
+    }
+
+    {
+        Runner runner(*processor, *editor, *view, frames);
+        MessageManager::getInstance()->runDispatchLoop();
+    }
+
+    editor.reset();
+    processor.reset();
+    return 0;
+}
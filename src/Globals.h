@@ -6,6 +6,7 @@ namespace globals {
 	inline const double F_MIN_FREQ = 20.0;
 	inline const double F_MAX_FREQ = 22050.0;
 	inline const double F_MAX_DRIVE = 36.0;
+	inline const int MOD_CONTROL_SAMPLES = 32; // oversampled samples between modulated drive and morph updates
 
 	inline unsigned int COLOR_BG = 0xff181818;
 	inline unsigned int COLOR_ACTIVE = 0xff00bbff;
@@ -29,6 +30,19 @@ namespace globals {
 	inline const int AUDIO_DRUMSBUF_MILLIS = 20;
 	inline const int AUDIO_NOTE_LENGTH_MILLIS = 100;
 	inline const int MAX_UNDO = 100;
+	inline const size_t UNDO_BUDGET_BYTES = 8 * 1024 * 1024; // undo memory per plugin instance, oldest states are dropped above this
+	inline const double SILENCE_THRESHOLD = 0.00001; // -100dB, input and filter state below this level are considered silent
+	inline const int FILTER_TAIL_MILLIS = 200; // filters ring time reported to the host at zero resonance
+	inline const double FILTER_TAIL_MAX_RES = 0.95; // resonance where the reported ring time stops growing, 20x the base tail
+	inline const double FILTER_SELF_OSC_RES = 0.9; // resonance from which the self oscillating models report an infinite tail
+	inline const int CAPTURE_RESOLUTION = 1024; // captured values per pattern cycle
+	inline const int CAPTURE_BUFFER_SIZE = 8192; // capture ring size, a few cycles of values
+
+	// quality governor
+	inline const double QUALITY_LOAD_HIGH = 0.6; // block load ratio that steps quality down
+	inline const double QUALITY_LOAD_LOW = 0.25; // block load ratio that steps quality up
+	inline const int QUALITY_DOWN_BLOCKS = 8; // blocks of sustained load before stepping down
+	inline const int QUALITY_UP_BLOCKS = 200; // blocks of sustained headroom before stepping up
 
 	// view consts
 	inline const int PLUG_WIDTH = 640;
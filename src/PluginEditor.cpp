@@ -132,6 +132,8 @@ FILTRAudioProcessorEditor::FILTRAudioProcessorEditor (FILTRAudioProcessor& p)
     settingsButton->onScaleChange = [this]() { setScaleFactor(audioProcessor.scale); };
     settingsButton->toggleUIComponents = [this]() { toggleUIComponents(); };
     settingsButton->toggleAbout = [this]() { about.get()->setVisible(true); };
+    settingsButton->toggleProfiler = [this]() { profilerOverlay->setVisible(!profilerOverlay->isVisible()); };
+    settingsButton->toggleLibrary = [this]() { libraryBrowser->setVisible(!libraryBrowser->isVisible()); };
     settingsButton->setBounds(col-20,row,25,25);
 
     mixDial = std::make_unique<TextDial>(p, "mix", "Mix", "", TextDialLabel::tdPercx100, 12.f, COLOR_NEUTRAL_LIGHT);
@@ -596,6 +598,16 @@ FILTRAudioProcessorEditor::FILTRAudioProcessorEditor (FILTRAudioProcessor& p)
     about->setBounds(getBounds());
     about->setVisible(false);
 
+    // PROFILER
+    profilerOverlay = std::make_unique<ProfilerOverlay>(p, *view);
+    addChildComponent(*profilerOverlay);
+    profilerOverlay->setBounds(view->getBounds());
+
+    // LIBRARY
+    libraryBrowser = std::make_unique<LibraryBrowser>(p);
+    addChildComponent(*libraryBrowser);
+    libraryBrowser->setBounds(view->getBounds());
+
     customLookAndFeel = new CustomLookAndFeel();
     setLookAndFeel(customLookAndFeel);
 
@@ -1026,6 +1038,9 @@ void FILTRAudioProcessorEditor::resized()
     bounds = seqWidget->getBounds();
     seqWidget->setBounds(bounds.withWidth(getWidth() - PLUG_PADDING * 2));
 
+    profilerOverlay->setBounds(view->getBounds());
+    libraryBrowser->setBounds(view->getBounds());
+
     bounds = latencyWarning.getBounds();
     latencyWarning.setBounds(bounds
         .withX(view->getBounds().getCentreX() - bounds.getWidth() / 2)
@@ -24,6 +24,8 @@
 #include "ui/EnvelopeWidget.h"
 #include "ui/Meter.h"
 #include "ui/AudioWidget.h"
+#include "ui/ProfilerOverlay.h"
+#include "ui/LibraryBrowser.h"
 
 using namespace globals;
 
@@ -49,6 +51,8 @@ private:
     FILTRAudioProcessor& audioProcessor;
     CustomLookAndFeel* customLookAndFeel = nullptr;
     std::unique_ptr<About> about;
+    std::unique_ptr<ProfilerOverlay> profilerOverlay;
+    std::unique_ptr<LibraryBrowser> libraryBrowser;
 
     std::vector<std::unique_ptr<TextButton>> patterns;
     std::vector<std::unique_ptr<TextButton>> respatterns;
@@ -18,7 +18,6 @@ FILTRAudioProcessor::FILTRAudioProcessor()
          .withInput("Sidechain", juce::AudioChannelSet::stereo(), true)
          .withOutput("Output", juce::AudioChannelSet::stereo(), true)
      )
-    , settings{}
     , params(*this, &undoManager, "PARAMETERS", {
         std::make_unique<juce::AudioParameterFloat>("mix", "Mix", 0.0f, 1.0f, 1.0f),
         std::make_unique<juce::AudioParameterInt>("pattern", "Cutoff Pattern", 1, 12, 1),
@@ -77,18 +76,32 @@ FILTRAudioProcessor::FILTRAudioProcessor()
 #endif
 {
     srand(static_cast<unsigned int>(time(nullptr))); // seed random generator
-    juce::PropertiesFile::Options options{};
-    options.applicationName = ProjectInfo::projectName;
-    options.filenameSuffix = ".settings";
-#if defined(JUCE_LINUX) || defined(JUCE_BSD)
-    options.folderName = "~/.config/filtr";
-#endif
-    options.osxLibrarySubFolder = "Application Support";
-    options.storageFormat = PropertiesFile::storeAsXML;
-    settings.setStorageParameters(options);
+
+    static const std::pair<const char*, uint32_t> paramGroups[] = {
+        { "smooth", DirtySmooth }, { "attack", DirtySmooth }, { "release", DirtySmooth },
+        { "trigger", DirtyTrigger },
+        { "tension", DirtyTension }, { "tensionatk", DirtyTension }, { "tensionrel", DirtyTension },
+        { "sync", DirtySync },
+        { "ftype", DirtyFilterType },
+        { "fmode", DirtyFilterParams }, { "flerp", DirtyFilterParams }, { "fdrive", DirtyFilterParams }, { "fmorph", DirtyFilterParams },
+        { "cutoff", DirtyCutoff },
+        { "res", DirtyRes },
+        { "cutenvon", DirtyCutEnv }, { "cutenvthresh", DirtyCutEnv }, { "cutenvatk", DirtyCutEnv },
+        { "cutenvrel", DirtyCutEnv }, { "cutenvlowcut", DirtyCutEnv }, { "cutenvhighcut", DirtyCutEnv },
+        { "resenvon", DirtyResEnv }, { "resenvthresh", DirtyResEnv }, { "resenvatk", DirtyResEnv },
+        { "resenvrel", DirtyResEnv }, { "resenvlowcut", DirtyResEnv }, { "resenvhighcut", DirtyResEnv },
+    };
 
     for (auto* param : getParameters()) {
         param->addListener(this);
+        uint32_t flags = 0;
+        if (auto* withID = dynamic_cast<AudioProcessorParameterWithID*>(param)) {
+            for (auto& [id, group] : paramGroups) {
+                if (withID->paramID == id)
+                    flags = group;
+            }
+        }
+        paramDirtyFlags.push_back(flags);
     }
 
     params.addParameterListener("pattern", this);
@@ -110,9 +123,7 @@ FILTRAudioProcessor::FILTRAudioProcessor()
         paintPatterns[i] = new Pattern(i + PAINT_PATS_IDX);
         if (i < 8) {
             auto preset = Presets::getPaintPreset(i);
-            for (auto& point : preset) {
-                paintPatterns[i]->insertPoint(point.x, point.y, point.tension, point.type);
-            }
+            paintPatterns[i]->insertPoints(std::vector<PPoint>(preset.begin(), preset.end()));
         }
         else {
             paintPatterns[i]->insertPoint(0.0, 1.0, 0.0, 1);
@@ -122,6 +133,20 @@ FILTRAudioProcessor::FILTRAudioProcessor()
     }
 
     sequencer = new Sequencer(*this);
+    sequencer->setUndoBudget(&undoBudget);
+    for (int i = 0; i < 12; ++i) {
+        patterns[i]->setUndoBudget(&undoBudget);
+        respatterns[i]->setUndoBudget(&undoBudget);
+    }
+    for (int i = 0; i < PAINT_PATS; ++i) {
+        paintPatterns[i]->setUndoBudget(&undoBudget);
+    }
+    capture.onCapture = [weakThis = WeakReference<FILTRAudioProcessor>(this)](std::vector<PPoint> points) {
+        MessageManager::callAsync([weakThis, points]() {
+            if (auto* processor = weakThis.get())
+                processor->replaceViewPattern(points);
+        });
+    };
     pattern = patterns[0];
     respattern = respatterns[0];
     viewPattern = pattern;
@@ -138,10 +163,12 @@ FILTRAudioProcessor::FILTRAudioProcessor()
     updatePatternFromRes();
 
     loadSettings();
+    sharedSettings->addChangeListener(this);
 }
 
 FILTRAudioProcessor::~FILTRAudioProcessor()
 {
+    sharedSettings->removeChangeListener(this);
     params.removeParameterListener("pattern", this);
     params.removeParameterListener("respattern", this);
 }
@@ -165,8 +192,8 @@ void FILTRAudioProcessor::parameterChanged (const juce::String& parameterID, flo
 void FILTRAudioProcessor::parameterValueChanged (int parameterIndex, float newValue)
 {
     (void)newValue;
-    (void)parameterIndex;
-    paramChanged = true;
+    if (parameterIndex >= 0 && parameterIndex < (int)paramDirtyFlags.size() && paramDirtyFlags[parameterIndex])
+        markDirty(paramDirtyFlags[parameterIndex]);
 }
 
 void FILTRAudioProcessor::parameterGestureChanged (int parameterIndex, bool gestureIsStarting)
@@ -175,52 +202,54 @@ void FILTRAudioProcessor::parameterGestureChanged (int parameterIndex, bool gest
     (void)gestureIsStarting;
 }
 
+/*
+    Settings are shared by all instances in the process, only the first instance reads them from disk
+    Paint patterns are installed from the shared point sets when they differ from the last installed set
+*/
 void FILTRAudioProcessor::loadSettings ()
 {
-    settings.closeFiles(); // FIX files changed by other plugin instances not loading
-    if (auto* file = settings.getUserSettings()) {
-        scale = (float)file->getDoubleValue("scale", 1.0f);
-        plugWidth = file->getIntValue("width", PLUG_WIDTH);
-        plugHeight = file->getIntValue("height", PLUG_HEIGHT);
-        auto tensionparam = (double)params.getRawParameterValue("tension")->load();
-        auto tensionatk = (double)params.getRawParameterValue("tensionatk")->load();
-        auto tensionrel = (double)params.getRawParameterValue("tensionrel")->load();
-
-        for (int i = 0; i < PAINT_PATS; ++i) {
-            auto str = file->getValue("paintpat" + String(i),"").toStdString();
-            if (!str.empty()) {
-                paintPatterns[i]->clear();
-                paintPatterns[i]->clearUndo();
-                double x, y, tension;
-                int type;
-                std::istringstream iss(str);
-                while (iss >> x >> y >> tension >> type) {
-                    paintPatterns[i]->insertPoint(x,y,tension,type);
-                }
-                paintPatterns[i]->setTension(tensionparam, tensionatk, tensionrel, dualTension);
-                paintPatterns[i]->buildSegments();
-            }
-        }
+    sharedSettings->reloadIfChanged(); // picks up changes saved by plugin instances in other processes
+    scale = (float)sharedSettings->getDoubleValue("scale", 1.0);
+    plugWidth = sharedSettings->getIntValue("width", PLUG_WIDTH);
+    plugHeight = sharedSettings->getIntValue("height", PLUG_HEIGHT);
+    libraryFolder = sharedSettings->getValue("libraryfolder");
+    auto tensionparam = (double)params.getRawParameterValue("tension")->load();
+    auto tensionatk = (double)params.getRawParameterValue("tensionatk")->load();
+    auto tensionrel = (double)params.getRawParameterValue("tensionrel")->load();
+
+    for (int i = 0; i < PAINT_PATS; ++i) {
+        auto points = sharedSettings->getPaintPattern(i);
+        if (points == nullptr || points == paintSources[i])
+            continue;
+        if (uimode == UIMode::PaintEdit && viewPattern == paintPatterns[i])
+            continue; // being edited, published when the editor closes
+
+        paintPatterns[i]->clear();
+        paintPatterns[i]->clearUndo();
+        paintPatterns[i]->insertPoints(*points);
+        paintPatterns[i]->setTension(tensionparam, tensionatk, tensionrel, dualTension);
+        paintPatterns[i]->buildSegments();
+        paintSources[i] = points;
     }
 }
 
 void FILTRAudioProcessor::saveSettings ()
 {
-    settings.closeFiles(); // FIX files changed by other plugin instances not loading
-    if (auto* file = settings.getUserSettings()) {
-        file->setValue("scale", scale);
-        file->setValue("width", plugWidth);
-        file->setValue("height", plugHeight);
-        for (int i = 0; i < PAINT_PATS; ++i) {
-            std::ostringstream oss;
-            auto points = paintPatterns[i]->points;
-            for (const auto& point : points) {
-                oss << point.x << " " << point.y << " " << point.tension << " " << point.type << " ";
-            }
-            file->setValue("paintpat"+juce::String(i), var(oss.str()));
-        }
+    sharedSettings->setValue("scale", scale);
+    sharedSettings->setValue("width", plugWidth);
+    sharedSettings->setValue("height", plugHeight);
+    sharedSettings->setValue("libraryfolder", libraryFolder);
+    for (int i = 0; i < PAINT_PATS; ++i) {
+        paintSources[i] = sharedSettings->setPaintPattern(i, paintPatterns[i]->points);
     }
-    settings.saveIfNeeded();
+    sharedSettings->save();
+}
+
+void FILTRAudioProcessor::changeListenerCallback (ChangeBroadcaster* source)
+{
+    (void)source;
+    loadSettings(); // paint patterns published by other instances
+    sendChangeMessage();
 }
 
 void FILTRAudioProcessor::setScale(float s)
@@ -267,7 +296,7 @@ void FILTRAudioProcessor::createUndoPoint(int patindex)
     Assigns the snapshot points to the pattern temporarily
     Creates an undo point and finally replaces back the points
 */
-void FILTRAudioProcessor::createUndoPointFromSnapshot(std::vector<PPoint> snapshot)
+void FILTRAudioProcessor::createUndoPointFromSnapshot(const std::vector<PPoint>& snapshot)
 {
     if (!Pattern::comparePoints(snapshot, viewPattern->points)) {
         auto points = viewPattern->points;
@@ -279,6 +308,23 @@ void FILTRAudioProcessor::createUndoPointFromSnapshot(std::vector<PPoint> snapsh
     }
 }
 
+/*
+    Replaces the view pattern with captured or library points
+    Called on the message thread, each replacement is a separate undo point
+*/
+void FILTRAudioProcessor::replaceViewPattern(const std::vector<PPoint>& points)
+{
+    if (sequencer->isOpen || uimode == UIMode::PaintEdit || points.empty())
+        return;
+
+    auto snapshot = viewPattern->points;
+    viewPattern->clear();
+    viewPattern->insertPoints(points);
+    viewPattern->buildSegments();
+    createUndoPointFromSnapshot(snapshot);
+    sendChangeMessage();
+}
+
 void FILTRAudioProcessor::setResonanceEditMode(bool isResonance)
 {
     MessageManager::callAsync([this, isResonance] {
@@ -391,9 +437,7 @@ void FILTRAudioProcessor::restorePaintPatterns()
         paintPatterns[i]->clear();
         paintPatterns[i]->clearUndo();
         auto preset = Presets::getPaintPreset(i);
-        for (auto& point : preset) {
-            paintPatterns[i]->insertPoint(point.x, point.y, point.tension, point.type);
-        }
+        paintPatterns[i]->insertPoints(std::vector<PPoint>(preset.begin(), preset.end()));
         paintPatterns[i]->buildSegments();
     }
     sendChangeMessage();
@@ -434,7 +478,31 @@ bool FILTRAudioProcessor::isMidiEffect() const
 
 double FILTRAudioProcessor::getTailLengthSeconds() const
 {
-    return 0.0;
+    // filters ring longer as the resonance rises, the bound uses the highest resonance the routing can reach
+    // past the tail the processing is bypassed internally until the input returns
+    double max = (double)params.getRawParameterValue("max")->load();
+    double resoffset = (double)params.getRawParameterValue("resoffset")->load();
+    bool resenvon = (bool)params.getRawParameterValue("resenvon")->load();
+    double resenvamt = (double)params.getRawParameterValue("resenvamt")->load();
+    double res = max + resoffset + (resenvon ? std::max(0.0, resenvamt) : 0.0);
+    for (int src = 0; src < ModBus::kNumSources; ++src) {
+        if (!ModBus::isBuiltin(src, ModBus::Res))
+            res += std::fabs(modbus.getDepth(src, ModBus::Res));
+    }
+    res = std::clamp(res, 0.0, 1.0);
+
+    // Moog, MS-20 and 303 feedback reaches self oscillation near full resonance and rings indefinitely
+    auto selfOscillates = [](int ftype) {
+        return ftype == kMoog12 || ftype == kMoog24 || ftype == kMS20 || ftype == kTB303;
+    };
+    bool oscillates = selfOscillates((int)params.getRawParameterValue("ftype")->load());
+    for (int i = 0; i < multibands - 1; ++i)
+        oscillates = oscillates || selfOscillates(bandFilterTypes[i]);
+
+    if (oscillates && res >= FILTER_SELF_OSC_RES)
+        return std::numeric_limits<double>::infinity();
+
+    return FILTER_TAIL_MILLIS / 1000.0 / (1.0 - std::min(res, FILTER_TAIL_MAX_RES));
 }
 
 int FILTRAudioProcessor::getNumPrograms()
@@ -464,9 +532,7 @@ void FILTRAudioProcessor::loadProgram (int index)
             ? Presets::getResPreset(idx)
             : Presets::getCutPreset(idx);
         pat.clear();
-        for (auto p = preset.begin(); p < preset.end(); ++p) {
-            pat.insertPoint(p->x, p->y, p->tension, p->type);
-        }
+        pat.insertPoints(std::vector<PPoint>(preset.begin(), preset.end()));
         pat.buildSegments();
         pat.clearUndo();
     };
@@ -526,10 +592,7 @@ void FILTRAudioProcessor::prepareToPlay (double sampleRate, int samplesPerBlock)
     oversampler.reset();
 
     int trigger = (int)params.getRawParameterValue("trigger")->load();
-    setLatencySamples(trigger == Trigger::Audio
-        ? (int)std::ceil(oversampler.getLatencyInSamples() + sampleRate * LATENCY_MILLIS / 1000.0)
-        : (int)std::ceil(oversampler.getLatencyInSamples())
-    );
+    setLatencySamples(getTargetLatency(trigger, sampleRate));
     auto maxLatency = (int)std::ceil(oversampler.getLatencyInSamples() + sampleRate * LATENCY_MILLIS / 1000.0);
     auto maxLatencyBlocks = 0;
     while (maxLatencyBlocks * samplesPerBlock < maxLatency) {
@@ -539,16 +602,27 @@ void FILTRAudioProcessor::prepareToPlay (double sampleRate, int samplesPerBlock)
     updatePatternFromCutoff();
     updatePatternFromRes();
 
-    lpFilterL.clear(0.0);
-    lpFilterR.clear(0.0);
-    hpFilterL.clear(0.0);
-    hpFilterR.clear(0.0);
+    filterBank.prepare(sampleRate, samplesPerBlock);
+    metering.prepare(sampleRate);
+    envBlock.resize(samplesPerBlock, 0.0);
+    lookaheadBuffer.setSize(2, samplesPerBlock);
+    sideBuffer.setSize(2, samplesPerBlock);
+    wetBuffer.setSize(2, samplesPerBlock);
+    modbus.prepare(samplesPerBlock * (int)oversampler.getOversamplingFactor());
+    viewBuf.resize(samplesPerBlock * (int)oversampler.getOversamplingFactor(), 0.0);
+    preAmpBuf.resize(samplesPerBlock * (int)oversampler.getOversamplingFactor(), 0.0);
+    for (auto& buf : bandCutBuf)
+        buf.resize(samplesPerBlock * (int)oversampler.getOversamplingFactor(), 0.0);
+    captureBuf.resize(samplesPerBlock, 0.0);
+    ccOutput.reset();
     cutenvBuf.resize(maxLatencyBlocks * 2 * samplesPerBlock, 0.0);
     resenvBuf.resize(maxLatencyBlocks * 2 * samplesPerBlock, 0.0);
     transDetectorL.clear(sampleRate);
     transDetectorR.clear(sampleRate);
     std::fill(monSamples.begin(), monSamples.end(), 0.0);
+    crossover.prepare(sampleRate * oversampler.getOversamplingFactor());
     resetFilters(sampleRate);
+    resetBandFilters(sampleRate, true);
     clearLatencyBuffers();
     onSlider();
 }
@@ -561,46 +635,8 @@ void FILTRAudioProcessor::resetFilters(double srate)
     auto fdrive = (double)params.getRawParameterValue("fdrive")->load();
     auto fmorph = (double)params.getRawParameterValue("fmorph")->load();
 
-    if (ftype == FilterType::kLinear12) {
-        lFilter = std::make_unique<Linear>(k12p);
-        rFilter = std::make_unique<Linear>(k12p);
-    }
-    else if (ftype == FilterType::kLinear24) {
-        lFilter = std::make_unique<Linear>(k24p);
-        rFilter = std::make_unique<Linear>(k24p);
-    }
-    else if (ftype == FilterType::kAnalog12) {
-        lFilter = std::make_unique<Analog>(k12p);
-        rFilter = std::make_unique<Analog>(k12p);
-    }
-    else if (ftype == FilterType::kAnalog24) {
-        lFilter = std::make_unique<Analog>(k24p);
-        rFilter = std::make_unique<Analog>(k24p);
-    }
-    else if (ftype == FilterType::kMoog12) {
-        lFilter = std::make_unique<Moog>(k12p);
-        rFilter = std::make_unique<Moog>(k12p);
-    }
-    else if (ftype == FilterType::kMoog24) {
-        lFilter = std::make_unique<Moog>(k24p);
-        rFilter = std::make_unique<Moog>(k24p);
-    }
-    else if (ftype == FilterType::kMS20) {
-        lFilter = std::make_unique<MS20>();
-        rFilter = std::make_unique<MS20>();
-    }
-    else if (ftype == FilterType::kTB303) {
-        lFilter = std::make_unique<TB303>();
-        rFilter = std::make_unique<TB303>();
-    }
-    else if (ftype == FilterType::kPhaserPos) {
-        lFilter = std::make_unique<Phaser>(true);
-        rFilter = std::make_unique<Phaser>(true);
-    }
-    else if (ftype == FilterType::kPhaserNeg) {
-        lFilter = std::make_unique<Phaser>(false);
-        rFilter = std::make_unique<Phaser>(false);
-    }
+    lFilter = createFilter(ftype);
+    rFilter = createFilter(ftype);
 
     lFilter->setMode(fmode);
     rFilter->setMode(fmode);
@@ -612,6 +648,9 @@ void FILTRAudioProcessor::resetFilters(double srate)
     rFilter->setMorph(fmorph);
     lFilter->setLerp((int)(srate * F_LERP_MILLIS * flerp / 1000.0));
     rFilter->setLerp((int)(srate * F_LERP_MILLIS * flerp / 1000.0));
+    lFilter->setMaxIterations(governor.getMaxIterations());
+    rFilter->setMaxIterations(governor.getMaxIterations());
+    coeffCounter = 0; // new filters are initialized on the next sample
 
     lftype = ftype;
     lfmode = fmode;
@@ -622,6 +661,79 @@ void FILTRAudioProcessor::resetFilters(double srate)
     MessageManager::callAsync([this]{ sendChangeMessage(); });
 }
 
+std::unique_ptr<Filter> FILTRAudioProcessor::createFilter(int ftype)
+{
+    if (ftype == FilterType::kLinear24) return std::make_unique<Linear>(k24p);
+    if (ftype == FilterType::kAnalog12) return std::make_unique<Analog>(k12p);
+    if (ftype == FilterType::kAnalog24) return std::make_unique<Analog>(k24p);
+    if (ftype == FilterType::kMoog12) return std::make_unique<Moog>(k12p);
+    if (ftype == FilterType::kMoog24) return std::make_unique<Moog>(k24p);
+    if (ftype == FilterType::kMS20) return std::make_unique<MS20>();
+    if (ftype == FilterType::kTB303) return std::make_unique<TB303>();
+    if (ftype == FilterType::kPhaserPos) return std::make_unique<Phaser>(true);
+    if (ftype == FilterType::kPhaserNeg) return std::make_unique<Phaser>(false);
+    return std::make_unique<Linear>(k12p);
+}
+
+/*
+    Applies the multiband settings, creates the filters of bands 2 to 4 when their type changes
+    and releases the filters of bands that were turned off
+*/
+void FILTRAudioProcessor::resetBandFilters(double srate, bool force)
+{
+    auto fmode = (FilterMode)(int)params.getRawParameterValue("fmode")->load();
+    auto flerp = (double)params.getRawParameterValue("flerp")->load();
+    auto fdrive = (double)params.getRawParameterValue("fdrive")->load();
+    auto fmorph = (double)params.getRawParameterValue("fmorph")->load();
+    auto tension = (double)params.getRawParameterValue("tension")->load();
+    auto tensionatk = (double)params.getRawParameterValue("tensionatk")->load();
+    auto tensionrel = (double)params.getRawParameterValue("tensionrel")->load();
+    int bands = multibands;
+
+    for (int i = 0; i < Crossover::kMaxBands - 1; ++i) {
+        if (i + 1 >= bands) {
+            bandFiltersL[i].reset();
+            bandFiltersR[i].reset();
+            lbandFilterTypes[i] = -1;
+            lbandPatterns[i] = -1;
+            continue;
+        }
+
+        int ftype = bandFilterTypes[i];
+        if (force || bandFiltersL[i] == nullptr || lbandFilterTypes[i] != ftype) {
+            bandFiltersL[i] = createFilter(ftype);
+            bandFiltersR[i] = createFilter(ftype);
+            for (auto* filter : { bandFiltersL[i].get(), bandFiltersR[i].get() }) {
+                filter->setMode(fmode);
+                filter->setDrive(fdrive);
+                filter->reset(0.0);
+                filter->setMorph(fmorph);
+                filter->setLerp((int)(srate * F_LERP_MILLIS * flerp / 1000.0));
+                filter->setMaxIterations(governor.getMaxIterations());
+            }
+            lbandFilterTypes[i] = ftype;
+            coeffCounter = 0;
+        }
+
+        int patidx = jlimit(0, 11, bandPatterns[i]);
+        if (lbandPatterns[i] != patidx) {
+            patterns[patidx]->setTension(tension, tensionatk, tensionrel, dualTension);
+            patterns[patidx]->buildSegments();
+            lbandPatterns[i] = patidx;
+        }
+    }
+
+    crossover.setup(std::max(2, bands), crossoverFreqs);
+    if (force || bands != lmultibands) {
+        crossover.clear();
+        for (int i = 0; i < Crossover::kMaxBands - 1; ++i) {
+            bandValues[i].reset(ypos);
+            bandypos[i] = ypos;
+        }
+        lmultibands = bands;
+    }
+}
+
 void FILTRAudioProcessor::releaseResources()
 {
     // When playback stops, you can use this as an opportunity to free up any
@@ -654,47 +766,71 @@ bool FILTRAudioProcessor::isBusesLayoutSupported (const BusesLayout& layouts) co
 }
 #endif
 
-void FILTRAudioProcessor::onSlider()
+void FILTRAudioProcessor::onSlider(uint32_t dirty)
 {
-    onSmoothChange();
+    if (dirty & DirtySmooth)
+        onSmoothChange();
     auto srate = getSampleRate();
 
     int trigger = (int)params.getRawParameterValue("trigger")->load();
-    if (trigger != ltrigger) {
+    if ((dirty & DirtyTrigger) && (trigger != ltrigger || outputCV != loutputCV)) {
         auto latency = getLatencySamples();
-        setLatencySamples(trigger == Trigger::Audio
-            ? (int)std::ceil(oversampler.getLatencyInSamples() + getSampleRate() * LATENCY_MILLIS / 1000.0)
-            : (int)std::ceil(oversampler.getLatencyInSamples())
-        );
+        setLatencySamples(getTargetLatency(trigger, srate));
         if (getLatencySamples() != latency && playing) {
             showLatencyWarning = true;
             MessageManager::callAsync([this]() { sendChangeMessage(); });
         }
         clearLatencyBuffers();
+        if (outputCV != loutputCV)
+            oversampler.reset(); // oversampler is idle in CV mode, drop its stale state
         ltrigger = trigger;
+        loutputCV = outputCV;
     }
-    if (trigger == Trigger::Sync && alwaysPlaying)
-        alwaysPlaying = false; // force alwaysPlaying off when trigger is not MIDI or Audio
+    if (dirty & DirtyTrigger) {
+        if (trigger == Trigger::Sync && alwaysPlaying)
+            alwaysPlaying = false; // force alwaysPlaying off when trigger is not MIDI or Audio
 
-    if (trigger != Trigger::MIDI && midiTrigger)
-        midiTrigger = false;
+        if (trigger != Trigger::MIDI && midiTrigger)
+            midiTrigger = false;
 
-    if (trigger != Trigger::Audio && audioTrigger)
-        audioTrigger = false;
+        if (trigger != Trigger::Audio && audioTrigger)
+            audioTrigger = false;
 
-    if (trigger != Trigger::Audio && useMonitor)
-        useMonitor = false;
+        if (trigger != Trigger::Audio && useMonitor)
+            useMonitor = false;
+    }
 
     auto tension = (double)params.getRawParameterValue("tension")->load();
     auto tensionatk = (double)params.getRawParameterValue("tensionatk")->load();
     auto tensionrel = (double)params.getRawParameterValue("tensionrel")->load();
-    if (tension != ltension || tensionatk != ltensionatk || tensionrel != ltensionrel) {
+    if ((dirty & DirtyTension) && (tension != ltension || tensionatk != ltensionatk || tensionrel != ltensionrel)) {
         onTensionChange();
         ltensionatk = tensionatk;
         ltensionrel = tensionrel;
         ltension = tension;
     }
 
+    if (dirty & DirtySync)
+        updateSync();
+
+    if (dirty & (DirtyFilterType | DirtyFilterParams | DirtyMultiband))
+        updateFilters(dirty);
+
+    if (dirty & DirtyCutoff)
+        updateCutoff();
+
+    if (dirty & DirtyRes)
+        updateRes();
+
+    if (dirty & DirtyCutEnv)
+        updateCutEnv();
+
+    if (dirty & DirtyResEnv)
+        updateResEnv();
+}
+
+void FILTRAudioProcessor::updateSync()
+{
     auto sync = (int)params.getRawParameterValue("sync")->load();
     if (sync == 0) syncQN = 1.; // not used
     else if (sync == 1) syncQN = 1./4.; // 1/16
@@ -714,52 +850,62 @@ void FILTRAudioProcessor::onSlider()
     else if (sync == 15) syncQN = 1./1.*1.5; // 1/4.
     else if (sync == 16) syncQN = 2./1.*1.5; // 1/2.
     else if (sync == 17) syncQN = 4./1.*1.5; // 1/1.
+}
 
-    auto highcut = (double)params.getRawParameterValue("highcut")->load();
-    auto lowcut = (double)params.getRawParameterValue("lowcut")->load();
-    lpFilterL.lp(srate, highcut, 0.707);
-    lpFilterR.lp(srate, highcut, 0.707);
-    hpFilterL.hp(srate, lowcut, 0.707);
-    hpFilterR.hp(srate, lowcut, 0.707);
-
+void FILTRAudioProcessor::updateFilters(uint32_t dirty)
+{
+    auto srate = getSampleRate();
     auto ftype = (FilterType)(int)params.getRawParameterValue("ftype")->load();
     auto fmode = (FilterMode)(int)params.getRawParameterValue("fmode")->load();
     auto flerp = (double)params.getRawParameterValue("flerp")->load();
     auto fdrive = (double)params.getRawParameterValue("fdrive")->load();
     auto fmorph = (double)params.getRawParameterValue("fmorph")->load();
 
-    if (lftype != ftype) {
+    if ((dirty & DirtyFilterType) && lftype != ftype) {
         resetFilters(srate);
         lFilter->reset(lastOutL); // prevent popping when changing filters
         rFilter->reset(lastOutR);
         lftype = ftype;
     }
 
+    if (dirty & DirtyMultiband)
+        resetBandFilters(srate);
+
+    if (!(dirty & DirtyFilterParams))
+        return;
+
     if (lflerp != flerp) {
         int duration = (int)(srate * F_LERP_MILLIS * flerp / 1000.0);
         lFilter->setLerp(duration);
         rFilter->setLerp(duration);
+        forEachBandFilter([duration](Filter& f) { f.setLerp(duration); });
         lflerp = flerp;
     }
 
     if (lfdrive != fdrive) {
         lFilter->setDrive(fdrive);
         rFilter->setDrive(fdrive);
+        forEachBandFilter([fdrive](Filter& f) { f.setDrive(fdrive); });
         lfdrive = fdrive;
     }
 
     if (lfmode != fmode) {
         lFilter->setMode(fmode);
         rFilter->setMode(fmode);
+        forEachBandFilter([fmode](Filter& f) { f.setMode(fmode); });
         lfmode = fmode;
     }
 
     if (lfmorph != fmorph) {
         lFilter->setMorph(fmorph);
         rFilter->setMorph(fmorph);
+        forEachBandFilter([fmorph](Filter& f) { f.setMorph(fmorph); });
         lfmorph = fmorph;
     }
+}
 
+void FILTRAudioProcessor::updateCutoff()
+{
     if (cutoffDirty) {
         float avg = (float)pattern->getavgY();
         float cut = params.getParameter("cutoff")->getValue();
@@ -771,19 +917,7 @@ void FILTRAudioProcessor::onSlider()
         cutoffDirtyCooldown = 5; // ignore cutoff updates for 5 blocks
     }
 
-    if (resDirty) {
-        float avg = (float)respattern->getavgY();
-        float rval = params.getParameter("res")->getValue();
-        if (avg != rval) {
-            params.getParameter("res")->setValueNotifyingHost(avg);
-            lres = (double)params.getRawParameterValue("res")->load();
-        }
-        resDirty = false;
-        resDirtyCooldown = 5;
-    }
-
     double cutoff = (double)params.getRawParameterValue("cutoff")->load();
-    double res = (double)params.getRawParameterValue("res")->load();
 
     // Ignores DAW updates for cutoff which was changed internally
     // DAW param updates are not reliable, on standalone works fine
@@ -794,7 +928,22 @@ void FILTRAudioProcessor::onSlider()
         updatePatternFromCutoff();
         lcutoff = cutoff;
     }
+}
 
+void FILTRAudioProcessor::updateRes()
+{
+    if (resDirty) {
+        float avg = (float)respattern->getavgY();
+        float rval = params.getParameter("res")->getValue();
+        if (avg != rval) {
+            params.getParameter("res")->setValueNotifyingHost(avg);
+            lres = (double)params.getRawParameterValue("res")->load();
+        }
+        resDirty = false;
+        resDirtyCooldown = 5;
+    }
+
+    double res = (double)params.getRawParameterValue("res")->load();
     if (resDirtyCooldown > 0) {
         lres = res;
     }
@@ -802,10 +951,12 @@ void FILTRAudioProcessor::onSlider()
         updatePatternFromRes();
         lres = res;
     }
+}
 
-    bool resenvOn = (bool)params.getRawParameterValue("resenvon")->load();
+void FILTRAudioProcessor::updateCutEnv()
+{
+    auto srate = getSampleRate();
     bool cutenvOn = (bool)params.getRawParameterValue("cutenvon")->load();
-
     if (cutenvOn) {
         double thresh = (double)params.getRawParameterValue("cutenvthresh")->load();
         double attack = (double)params.getRawParameterValue("cutenvatk")->load();
@@ -814,7 +965,12 @@ void FILTRAudioProcessor::onSlider()
         double cutenvHighCut = (double)params.getRawParameterValue("cutenvhighcut")->load();
         cutenv.prepare(srate, thresh, cutenvAutoRel, attack, 0.0, release, cutenvLowCut, cutenvHighCut);
     }
+}
 
+void FILTRAudioProcessor::updateResEnv()
+{
+    auto srate = getSampleRate();
+    bool resenvOn = (bool)params.getRawParameterValue("resenvon")->load();
     if (resenvOn) {
         double thresh = (double)params.getRawParameterValue("resenvthresh")->load();
         double attack = (double)params.getRawParameterValue("resenvatk")->load();
@@ -840,13 +996,13 @@ void FILTRAudioProcessor::updatePatternFromRes()
 void FILTRAudioProcessor::updateCutoffFromPattern()
 {
     cutoffDirty = true;
-    paramChanged = true;
+    markDirty(DirtyCutoff);
 }
 
 void FILTRAudioProcessor::updateResFromPattern()
 {
     resDirty = true;
-    paramChanged = true;
+    markDirty(DirtyRes);
 }
 
 void FILTRAudioProcessor::onTensionChange()
@@ -858,6 +1014,30 @@ void FILTRAudioProcessor::onTensionChange()
     respattern->setTension(tension, tensionatk, tensionrel, dualTension);
     pattern->buildSegments();
     respattern->buildSegments();
+    for (int i = 0; i < multibands - 1; ++i) {
+        auto* bandpat = patterns[jlimit(0, 11, bandPatterns[i])];
+        bandpat->setTension(tension, tensionatk, tensionrel, dualTension);
+        bandpat->buildSegments();
+    }
+
+    // paint patterns are only drawn by the UI, the audio thread leaves them to the view timer
+    if (MessageManager::existsAndIsCurrentThread())
+        updatePaintTension();
+    else
+        paintTensionPending.store(true);
+}
+
+void FILTRAudioProcessor::applyPaintTension()
+{
+    if (paintTensionPending.exchange(false))
+        updatePaintTension();
+}
+
+void FILTRAudioProcessor::updatePaintTension()
+{
+    auto tension = (double)params.getRawParameterValue("tension")->load();
+    auto tensionatk = (double)params.getRawParameterValue("tensionatk")->load();
+    auto tensionrel = (double)params.getRawParameterValue("tensionrel")->load();
     for (int i = 0; i < PAINT_PATS; ++i) {
         paintPatterns[i]->setTension(tension, tensionatk, tensionrel, dualTension);
         paintPatterns[i]->buildSegments();
@@ -870,6 +1050,7 @@ void FILTRAudioProcessor::onPlay()
     clearLatencyBuffers();
     resenv.clear();
     cutenv.clear();
+    filterBank.clear();
     std::fill(cutenvBuf.begin(), cutenvBuf.end(), 0.0);
     std::fill(resenvBuf.begin(), resenvBuf.end(), 0.0);
     envwritepos = 0;
@@ -893,6 +1074,8 @@ void FILTRAudioProcessor::onPlay()
 
     lFilter->reset(0.0);
     rFilter->reset(0.0);
+    forEachBandFilter([](Filter& f) { f.reset(0.0); });
+    crossover.clear();
 
     if (trigger == 0 || alwaysPlaying) {
         restartEnv(false);
@@ -936,21 +1119,50 @@ void FILTRAudioProcessor::clearWaveBuffers()
     std::fill(postSamples.begin(), postSamples.end(), 0.0);
 }
 
+int FILTRAudioProcessor::getTargetLatency(int trigger, double srate)
+{
+    // CV is rendered at base rate without oversampling, only the audio trigger lookahead remains
+    double latency = outputCV ? 0.0 : oversampler.getLatencyInSamples();
+    if (trigger == Trigger::Audio)
+        latency += srate * LATENCY_MILLIS / 1000.0;
+    return (int)std::ceil(latency);
+}
+
 void FILTRAudioProcessor::clearLatencyBuffers()
 {
     int trigger = (int)params.getRawParameterValue("trigger")->load();
     auto latency = trigger == Trigger::Audio
         ? (int)std::ceil(getSampleRate() * LATENCY_MILLIS / 1000.0)
         : 0;
-    latency *= (int)oversampler.getOversamplingFactor();
-    latBufferL.resize(latency, 0.0); // these are latency buffers for audio trigger only
-    latBufferR.resize(latency, 0.0);
+    latBufferL.assign(latency, 0.0); // base rate lookahead rings for audio trigger only
+    latBufferR.assign(latency, 0.0);
     monLatBufferL.resize(getLatencySamples(), 0.0);
     monLatBufferR.resize(getLatencySamples(), 0.0);
     latpos = 0;
     monWritePos = 0;
 }
 
+/*
+    Delays the dry block by the audio trigger lookahead
+    Copies in chunks no longer than the ring, each chunk reads the oldest samples before overwriting them
+*/
+void FILTRAudioProcessor::applyLookahead(const AudioBuffer<double>& input, AudioBuffer<double>& output, int numSamples)
+{
+    int latency = (int)latBufferL.size();
+    int pos = latpos;
+    for (int offset = 0; offset < numSamples;) {
+        int chunk = std::min({ numSamples - offset, latency - pos });
+        for (int channel = 0; channel < 2; ++channel) {
+            auto* ring = channel == 0 ? latBufferL.data() : latBufferR.data();
+            FloatVectorOperations::copy(output.getWritePointer(channel, offset), ring + pos, chunk);
+            FloatVectorOperations::copy(ring + pos, input.getReadPointer(channel, offset), chunk);
+        }
+        offset += chunk;
+        pos = (pos + chunk) % latency;
+    }
+    latpos = pos;
+}
+
 double inline FILTRAudioProcessor::getYcut(double x, double min, double max, double offset)
 {
     return std::clamp(min + (max - min) * (1 - pattern->get_y_at(x)) + offset, 0.0, 1.0);
@@ -970,12 +1182,16 @@ void FILTRAudioProcessor::onSmoothChange()
         release *= release;
         value->setup(attack * 0.25, release * 0.25, getSampleRate() * oversampler.getOversamplingFactor());
         resvalue->setup(attack * 0.25, release * 0.25, getSampleRate() * oversampler.getOversamplingFactor());
+        for (auto& bandValue : bandValues)
+            bandValue.setup(attack * 0.25, release * 0.25, getSampleRate() * oversampler.getOversamplingFactor());
     }
     else {
         float lfosmooth = params.getRawParameterValue("smooth")->load();
         lfosmooth *= lfosmooth;
         value->setup(lfosmooth * 0.25, lfosmooth * 0.25, getSampleRate() * oversampler.getOversamplingFactor());
         resvalue->setup(lfosmooth * 0.25, lfosmooth * 0.25, getSampleRate() * oversampler.getOversamplingFactor());
+        for (auto& bandValue : bandValues)
+            bandValue.setup(lfosmooth * 0.25, lfosmooth * 0.25, getSampleRate() * oversampler.getOversamplingFactor());
     }
 }
 
@@ -1021,6 +1237,97 @@ void FILTRAudioProcessor::queueResPattern(int patidx)
     }
 }
 
+/*
+    A block can be bypassed when the input has been silent for longer than the plugin latency
+    and the filters and envelope followers have decayed, the output is silent in that case
+    Blocks with MIDI notes, queued patterns or pending outputs are always processed
+*/
+bool FILTRAudioProcessor::canBypassBlock(const MidiBuffer& midiMessages, int numSamples)
+{
+    int trigger = (int)params.getRawParameterValue("trigger")->load();
+    if (trigger == Trigger::Audio || outputCV || outputCC > 0 || dirtyFlags.load() != 0)
+        return false;
+
+    if (silentSamples < getLatencySamples() + numSamples)
+        return false;
+
+    if (queuedPattern || queuedResPattern || !midiIn.empty() || !midiOut.empty())
+        return false;
+
+    for (const auto metadata : midiMessages) {
+        auto message = metadata.getMessage();
+        if (message.isNoteOn() || message.isNoteOff())
+            return false;
+    }
+
+    bool cutenvon = (bool)params.getRawParameterValue("cutenvon")->load();
+    bool resenvon = (bool)params.getRawParameterValue("resenvon")->load();
+    if ((cutenvon && !cutenv.isIdle(SILENCE_THRESHOLD)) || (resenvon && !resenv.isIdle(SILENCE_THRESHOLD)))
+        return false;
+
+    bool idle = lFilter->isIdle(SILENCE_THRESHOLD) && rFilter->isIdle(SILENCE_THRESHOLD);
+    forEachBandFilter([&idle](Filter& f) { idle = idle && f.isIdle(SILENCE_THRESHOLD); });
+    return idle;
+}
+
+/*
+    Advances the envelope by a block of samples without processing audio
+    Used by silent blocks so the envelope stays in sync when audio returns
+*/
+void FILTRAudioProcessor::advanceEnvelope(int numSamples)
+{
+    int trigger = (int)params.getRawParameterValue("trigger")->load();
+    int sync = (int)params.getRawParameterValue("sync")->load();
+    double min = (double)params.getRawParameterValue("min")->load();
+    double max = (double)params.getRawParameterValue("max")->load();
+    double ratehz = (double)params.getRawParameterValue("rate")->load();
+    double phase = (double)params.getRawParameterValue("phase")->load();
+    double cutoffset = (double)params.getRawParameterValue("cutoffset")->load();
+    double resoffset = (double)params.getRawParameterValue("resoffset")->load();
+    double srate = getSampleRate();
+    int numUpSamples = numSamples * (int)oversampler.getOversamplingFactor();
+
+    if (playing) {
+        beatPos = ppqPosition;
+        ratePos = beatPos * secondsPerBeat * ratehz;
+    }
+
+    if (trigger == Trigger::Sync) {
+        xpos = sync > 0
+            ? beatPos / syncQN + phase
+            : ratePos + phase;
+        xpos -= std::floor(xpos);
+    }
+    else if (trigger == Trigger::MIDI) {
+        auto inc = sync > 0
+            ? beatsPerSample / syncQN
+            : 1 / (srate * oversampler.getOversamplingFactor()) * ratehz;
+        xpos += inc * numUpSamples;
+        trigpos += inc * numUpSamples;
+        xpos -= std::floor(xpos);
+
+        if (!alwaysPlaying) {
+            if (midiTrigger && trigpos >= 1.0) {
+                midiTrigger = false;
+            }
+            if (!midiTrigger) {
+                xpos = phase ? phase : 1.0;
+            }
+        }
+    }
+
+    beatPos += beatsPerSample * numUpSamples;
+    ratePos += numSamples / srate * ratehz;
+
+    // nothing is audible, jump straight to the envelope values
+    ypos = getYcut(xpos, min, max, cutoffset);
+    yres = getYres(xpos, min, max, resoffset);
+    value->reset(ypos);
+    resvalue->reset(yres);
+    xenv.store(xpos);
+    yenv.store(resonanceEditMode ? yres : ypos);
+}
+
 bool FILTRAudioProcessor::supportsDoublePrecisionProcessing() const
 {
     return true;
@@ -1039,6 +1346,13 @@ template <typename FloatType>
 void FILTRAudioProcessor::processBlockByType (AudioBuffer<FloatType>& buffer, juce::MidiBuffer& midiMessages)
 {
     juce::ScopedNoDenormals disableDenormals;
+    auto startTicks = Time::getHighResolutionTicks();
+    bool profiling = profiler.enabled.load();
+    auto lap = [&](Profiler::Stage stage) {
+        if (profiling) profiler.lap(stage);
+    };
+    if (profiling) profiler.begin();
+
     double srate = getSampleRate();
     int samplesPerBlock = getBlockSize();
     int samplingFactor = (int)oversampler.getOversamplingFactor();
@@ -1079,6 +1393,8 @@ void FILTRAudioProcessor::processBlockByType (AudioBuffer<FloatType>& buffer, ju
         }
     }
 
+    lap(Profiler::Playhead);
+
     int inputBusCount = getBusCount(true);
     int audioOutputs = getTotalNumOutputChannels();
     int audioInputs = inputBusCount > 0 ? getChannelCountOfBus(true, 0) : 0;
@@ -1088,6 +1404,29 @@ void FILTRAudioProcessor::processBlockByType (AudioBuffer<FloatType>& buffer, ju
     if (!audioInputs || !audioOutputs)
         return;
 
+    metering.push(Metering::Input, buffer.getReadPointer(0), buffer.getReadPointer(audioInputs > 1 ? 1 : 0), numSamples);
+
+    // silence bypass, skips the whole chain while the input and the filters are silent
+    bool inputSilent = true;
+    for (int channel = 0; channel < buffer.getNumChannels() && inputSilent; ++channel) {
+        inputSilent = (double)buffer.getMagnitude(channel, 0, numSamples) < SILENCE_THRESHOLD;
+    }
+    silentSamples = inputSilent ? silentSamples + numSamples : 0;
+
+    if (inputSilent && canBypassBlock(midiMessages, numSamples)) {
+        advanceEnvelope(numSamples);
+        for (int channel = 0; channel < audioOutputs; ++channel) {
+            buffer.clear(channel, 0, numSamples);
+        }
+        int trigger = (int)params.getRawParameterValue("trigger")->load();
+        drawSeek.store(playing && (trigger == Trigger::Sync || midiTrigger));
+        metering.push<FloatType>(Metering::Wet, nullptr, nullptr, numSamples);
+        metering.push<FloatType>(Metering::Output, nullptr, nullptr, numSamples);
+        lastOutL = 0.0;
+        lastOutR = 0.0;
+        return;
+    }
+
     // Prepare a double buffer for processing
     juce::AudioBuffer<double> doubleBuffer(2, numSamples);
     for (int channel = 0; channel < 2; ++channel) {
@@ -1097,10 +1436,46 @@ void FILTRAudioProcessor::processBlockByType (AudioBuffer<FloatType>& buffer, ju
             dst[sample] = static_cast<double>(src[sample]);
     }
 
+    // wet levels are only gathered while a meter is showing
+    bool meterWet = metering.isEnabled();
+    if (meterWet)
+        wetBuffer.setSize(2, numSamples, false, false, true); // sized in prepareToPlay, no allocation
+
+    // sidechain double buffer, silent when there is no sidechain bus
+    sideBuffer.setSize(2, numSamples, false, false, true); // sized in prepareToPlay, no allocation
+    sideBuffer.clear();
+    for (int channel = 0; channel < 2 && sideInputs; ++channel) {
+        auto* src = buffer.getReadPointer(channel == 0 || sideInputs == 1 ? audioInputs : audioInputs + 1);
+        auto* dst = sideBuffer.getWritePointer(channel);
+        for (int sample = 0; sample < numSamples; ++sample)
+            dst[sample] = static_cast<double>(src[sample]);
+    }
+
     // Oversample the double buffer
+    // CV output skips the oversampler, the envelope timeline still runs at the oversampled rate
+    // audio trigger lookahead, the dry block is delayed at base rate before upsampling
+    // the transient detector and followers keep reading the undelayed doubleBuffer
+    bool useLookahead = !outputCV && !latBufferL.empty()
+        && (int)params.getRawParameterValue("trigger")->load() == Trigger::Audio;
+    if (useLookahead) {
+        lookaheadBuffer.setSize(2, numSamples, false, false, true);
+        applyLookahead(doubleBuffer, lookaheadBuffer, numSamples);
+    }
+    const auto& upsamplerInput = useLookahead ? lookaheadBuffer : doubleBuffer;
+
     juce::dsp::AudioBlock<double> block(doubleBuffer);
-    auto upsampledBlock = oversampler.processSamplesUp(block);
-    int numUpSamples = (int)upsampledBlock.getNumSamples();
+    juce::dsp::AudioBlock<double> upsampledBlock;
+    if (!outputCV) {
+        // the downsampler still writes into block, the lookahead buffer is only read
+        upsampledBlock = oversampler.processSamplesUp(juce::dsp::AudioBlock<const double>(upsamplerInput.getArrayOfReadPointers(), 2, (size_t)numSamples));
+    }
+    int numUpSamples = numSamples * samplingFactor;
+
+    // oversampled channels
+    double* upd[2] = { nullptr, nullptr };
+    for (int channel = 0; channel < 2 && !outputCV; ++channel)
+        upd[channel] = upsampledBlock.getChannelPointer((size_t)channel);
+    lap(Profiler::Upsample);
 
     // load params
     double mix = (double)params.getRawParameterValue("mix")->load();
@@ -1124,12 +1499,17 @@ void FILTRAudioProcessor::processBlockByType (AudioBuffer<FloatType>& buffer, ju
     double resenvamt = (double)params.getRawParameterValue("resenvamt")->load();
     sense = std::pow(sense, 2); // make audio trigger sensitivity more responsive
 
+    // quality governor settings, full quality unless autoQuality is on
+    int coeffRate = governor.getCoeffRate();
+    int displayRate = governor.getDisplayRate();
+
     // process viewport background display wave samples
-    auto processDisplaySample = [&](int sampidx, double xpos, double prelsamp, double prersamp) {
+    auto processDisplaySample = [&](double xpos, double prelsamp, double prersamp, double postlsamp, double postrsamp) {
+        if (++displayCounter < displayRate)
+            return;
+        displayCounter = 0;
         auto preamp = std::max(std::fabs(prelsamp), std::fabs(prersamp));
-        auto postlsamp = (double)upsampledBlock.getSample(0, sampidx);
-        auto postrsamp = audioInputs > 1 ? (double)upsampledBlock.getSample(1, sampidx) : postlsamp;
-        auto postamp = std::max(std::fabs(postlsamp), std::fabs(postrsamp));
+        auto postamp = std::max(std::fabs(postlsamp), std::fabs(audioInputs > 1 ? postrsamp : postlsamp));
         winpos = (int)std::floor(xpos * viewW);
         if (lwinpos != winpos) {
             preSamples[winpos] = 0.0;
@@ -1165,60 +1545,73 @@ void FILTRAudioProcessor::processBlockByType (AudioBuffer<FloatType>& buffer, ju
     };
 
     // applies envelope to a sample index
-    auto applyFilter = [&](int sampidx, double env, double resenv, double lsample, double rsample) {
-        double cutoff = Utils::normalToFreq(env);
-        lFilter->init(srate * samplingFactor, cutoff, resenv);
-        rFilter->init(srate * samplingFactor, cutoff, resenv);
-        double outl = lFilter->eval(lsample) * gain;
-        double outr = rFilter->eval(rsample) * gain;
+    // multiband mode splits the sample with the crossover, band 1 runs through the main filters
+    // and bands 2 to 4 through their own filters driven by their own cutoff envelopes
+    auto applyFilter = [&](int sampidx, double env, double resenv, double lsample, double rsample, double wetmix) {
+        bool init = coeffCounter == 0;
+        if (init) {
+            double cutoff = Utils::normalToFreq(env);
+            lFilter->init(srate * samplingFactor, cutoff, resenv);
+            rFilter->init(srate * samplingFactor, cutoff, resenv);
+        }
+        coeffCounter = (coeffCounter + 1) % coeffRate;
+        double outl;
+        double outr;
+        if (lmultibands > 1) {
+            double bandL[Crossover::kMaxBands];
+            double bandR[Crossover::kMaxBands];
+            crossover.process(lsample, rsample, bandL, bandR);
+            outl = lFilter->eval(bandL[0]);
+            outr = rFilter->eval(bandR[0]);
+            for (int band = 1; band < lmultibands; ++band) {
+                auto& bandFilterL = *bandFiltersL[band - 1];
+                auto& bandFilterR = *bandFiltersR[band - 1];
+                if (init) {
+                    double cutoff = Utils::normalToFreq(bandCutBuf[band - 1][sampidx]);
+                    bandFilterL.init(srate * samplingFactor, cutoff, resenv);
+                    bandFilterR.init(srate * samplingFactor, cutoff, resenv);
+                }
+                outl += bandFilterL.eval(bandL[band]);
+                outr += bandFilterR.eval(bandR[band]);
+                bandFilterL.tick();
+                bandFilterR.tick();
+            }
+            outl *= gain;
+            outr *= gain;
+        }
+        else {
+            outl = lFilter->eval(lsample) * gain;
+            outr = rFilter->eval(rsample) * gain;
+        }
         lFilter->tick();
         rFilter->tick();
 
+        // the wet meter takes the first oversampled sample of each base rate sample
+        if (meterWet && sampidx % samplingFactor == 0) {
+            wetBuffer.setSample(0, sampidx / samplingFactor, outl);
+            wetBuffer.setSample(1, sampidx / samplingFactor, outr);
+        }
+
         for (int channel = 0; channel < audioOutputs; ++channel) {
             auto wet = channel == 0 ? outl : outr;
-            auto dry = (double)upsampledBlock.getSample(channel, sampidx);
-            if (outputCV) {
-                upsampledBlock.setSample(channel, sampidx, env);
-            }
-            else {
-                upsampledBlock.setSample(channel, sampidx, wet * mix + dry * (1.0 - mix));
-            }
+            auto dry = upd[channel][sampidx];
+            upd[channel][sampidx] = wet * wetmix + dry * (1.0 - wetmix);
         }
     };
 
-    // gets envelope followers processed sample for a given oversample buffer index
-    // the env followers process the dry audio buffer into a circular buffer
-    // an oversampled samp index matches the followers buffer latency samples ago
-    // and has to be downsampled or interpolated in this case
-    auto getEnvelopeFollowerOffset = [&](int ossample)->std::array<double, 2> {
-        double basePos = ((double)ossample - oslatency) / samplingFactor;
-        int baseIndex = (int)std::floor(basePos);
-        double frac = basePos - baseIndex;
-
-        int index1 = (envreadpos + baseIndex) % cutenvBuf.size();
-        int index2 = (envreadpos + baseIndex + 1) % cutenvBuf.size();
-        std::array<double, 2> res = { 0.0, 0.0 };
-
-        {
-            double env1 = cutenvBuf[index1];
-            double env2 = cutenvBuf[index2];
-            double val = env1 + frac * (env2 - env1);
-            res[0] = val;
-        }
-
-        {
-            double env1 = resenvBuf[index1];
-            double env2 = resenvBuf[index2];
-            double val = env1 + frac * (env2 - env1);
-            res[1] = val;
-        }
-
-        return res; // returns [cutEnvResult, resEnvResult]
-    };
+    if (outputCV != loutputCV)
+        markDirty(DirtyTrigger);
+    if (auto dirty = dirtyFlags.exchange(0)) {
+        onSlider(dirty);
+    }
 
-    if (paramChanged) {
-        onSlider();
-        paramChanged = false;
+    int qualityTier = governor.tier.load();
+    if (qualityTier != lqualityTier) {
+        lFilter->setMaxIterations(governor.getMaxIterations());
+        rFilter->setMaxIterations(governor.getMaxIterations());
+        int iterations = governor.getMaxIterations();
+        forEachBandFilter([iterations](Filter& f) { f.setMaxIterations(iterations); });
+        lqualityTier = qualityTier;
     }
 
     if (cutoffDirtyCooldown > 0)
@@ -1258,47 +1651,37 @@ void FILTRAudioProcessor::processBlockByType (AudioBuffer<FloatType>& buffer, ju
         return msg.offset < 0;
     }), midiIn.end());
 
-    // update outputs with last block information at the start of the new block
-    if (outputCC > 0) {
-        auto val = (int)std::round(ypos*127.0);
-        if (bipolarCC) val -= 64;
-        auto cc = MidiMessage::controllerEvent(outputCCChan + 1, outputCC-1, val);
-        midiMessages.addEvent(cc, 0);
-    }
-
     // keep beatPos in sync with playhead so plugin can be bypassed and return to its sync pos
     if (playing) {
         beatPos = ppqPosition;
         ratePos = beatPos * secondsPerBeat * ratehz;
     }
 
+    lap(Profiler::Setup);
+
+    // band limit the transient detector and followers inputs, bands with matching settings are processed once
+    int transBand = trigger == Audio
+        ? filterBank.request(FilterBank::Transient, useSidechain && sideInputs ? FilterBank::Side : FilterBank::Main,
+            lowcut > 20.0 ? lowcut : 0.0, highcut < 20000.0 ? highcut : 0.0)
+        : -1;
+    int cutenvBand = cutenvon
+        ? filterBank.request(FilterBank::CutEnv, cutenvSidechain ? FilterBank::Side : FilterBank::Main, cutenv.lowcut, cutenv.highcut)
+        : -1;
+    int resenvBand = resenvon
+        ? filterBank.request(FilterBank::ResEnv, resenvSidechain ? FilterBank::Side : FilterBank::Main, resenv.lowcut, resenv.highcut)
+        : -1;
+    filterBank.process(doubleBuffer.getReadPointer(0), doubleBuffer.getReadPointer(1),
+        sideBuffer.getReadPointer(0), sideBuffer.getReadPointer(1), numSamples);
+
     // audio trigger transient detection and monitoring
     // direct audio buffer processing, not oversampled
     if (trigger == Audio) {
+        const double* transL = filterBank.getLeft(transBand);
+        const double* transR = filterBank.getRight(transBand);
         for (int sample = 0; sample < numSamples; ++sample) {
-            // read audio samples
-            double lsample = (double)buffer.getSample(0, sample);
-            double rsample = (double)buffer.getSample(audioInputs > 1 ? 1 : 0, sample);
-
-            // read sidechain samples
-            double lsidesample = 0.0;
-            double rsidesample = 0.0;
-            if (useSidechain && sideInputs) {
-                lsidesample = (double)buffer.getSample(audioInputs, sample);
-                rsidesample = (double)buffer.getSample(sideInputs > 1 ? audioInputs + 1 : audioInputs, sample);
-            }
-
             // Detect audio transients
-            auto monSampleL = useSidechain ? lsidesample : lsample;
-            auto monSampleR = useSidechain ? rsidesample : rsample;
-            if (lowcut > 20.0) {
-                monSampleL = hpFilterL.df1(monSampleL);
-                monSampleR = hpFilterR.df1(monSampleR);
-            }
-            if (highcut < 20000.0) {
-                monSampleL = lpFilterL.df1(monSampleL);
-                monSampleR = lpFilterR.df1(monSampleR);
-            }
+            auto monSampleL = transL[sample];
+            auto monSampleR = transR[sample];
 
             if (transDetectorL.detect(algo, monSampleL, threshold, sense) ||
                 transDetectorR.detect(algo, monSampleR, threshold, sense))
@@ -1333,46 +1716,57 @@ void FILTRAudioProcessor::processBlockByType (AudioBuffer<FloatType>& buffer, ju
         }
     }
 
-    // envelope follower processing on dry buffers
-    envreadpos = envwritepos;
-    for (int sample = 0; sample < numSamples; ++sample) {
-        if (resenvon || cutenvon) {
-            double lsample = (double)buffer.getSample(0, sample);
-            double rsample = (double)buffer.getSample(audioInputs > 1 ? 1 : 0, sample);
-            double lsidesample = sideInputs ? (double)buffer.getSample(audioInputs, sample) : 0.0;
-            double rsidesample = sideInputs ? (double)buffer.getSample(sideInputs > 1 ? audioInputs + 1 : audioInputs, sample) : 0.0;
-
-            if (cutenvon) {
-                cutenvBuf[envwritepos] = cutenv.process(
-                    cutenvSidechain ? lsidesample : lsample,
-                    cutenvSidechain ? rsidesample : rsample
-                );
-                if (cutenvMonitor) {
-                    buffer.setSample(0, sample, (FloatType)cutenv.outl);
-                    if (audioInputs > 1) {
-                        buffer.setSample(1, sample, (FloatType)cutenv.outr);
-                    }
-                }
-            }
+    lap(Profiler::Transient);
 
-            if (resenvon) {
-                resenvBuf[envwritepos] = resenv.process(
-                    resenvSidechain ? lsidesample : lsample,
-                    resenvSidechain ? rsidesample : rsample
-                );
-                if (resenvMonitor) {
-                    buffer.setSample(0, sample, (FloatType)resenv.outl);
-                    if (audioInputs > 1) {
-                        buffer.setSample(1, sample, (FloatType)resenv.outr);
-                    }
-                }
+    // envelope follower processing on the band limited dry buffers
+    // followers run blockwise into envBlock which is then written to the circular buffers
+    envreadpos = envwritepos;
+    int envsize = (int)cutenvBuf.size();
+    if ((int)envBlock.size() < numSamples)
+        envBlock.resize(numSamples, 0.0);
+
+    auto processFollower = [&](Follower& follower, int band, std::vector<double>& envBuf, bool monitor) {
+        const double* bandL = filterBank.getLeft(band);
+        const double* bandR = filterBank.getRight(band);
+        follower.process(bandL, bandR, envBlock.data(), numSamples);
+        for (int sample = 0; sample < numSamples; ++sample)
+            envBuf[(envwritepos + sample) % envsize] = envBlock[sample];
+
+        if (monitor) {
+            for (int sample = 0; sample < numSamples; ++sample) {
+                buffer.setSample(0, sample, (FloatType)bandL[sample]);
+                if (audioInputs > 1)
+                    buffer.setSample(1, sample, (FloatType)bandR[sample]);
             }
         }
-        envwritepos = (envwritepos + 1) % (int)cutenvBuf.size();
-    }
+    };
+
+    if (cutenvon)
+        processFollower(cutenv, cutenvBand, cutenvBuf, cutenvMonitor);
+    if (resenvon)
+        processFollower(resenv, resenvBand, resenvBuf, resenvMonitor);
+    envwritepos = (envwritepos + numSamples) % envsize;
+
+    lap(Profiler::Follower);
 
     // ================================================= MAIN PROCESSING LOOP
 
+    modbus.ensureSize(numUpSamples);
+    modbus.update(); // routing edits published since the last block
+    if ((int)viewBuf.size() < numUpSamples)
+        viewBuf.resize(numUpSamples, 0.0);
+    if ((int)preAmpBuf.size() < numUpSamples)
+        preAmpBuf.resize(numUpSamples, 0.0);
+    for (int band = 1; band < lmultibands; ++band) {
+        if ((int)bandCutBuf[band - 1].size() < numUpSamples)
+            bandCutBuf[band - 1].resize(numUpSamples, 0.0);
+    }
+
+    double* patcutsrc = modbus.getSource(ModBus::PatCut);
+    double* patressrc = modbus.getSource(ModBus::PatRes);
+    double* velsrc = modbus.getSource(ModBus::Velocity);
+
+    // timeline pass, advances the envelope and renders the pattern sources
     for (int sample = 0; sample < numUpSamples; ++sample) {
         if (playing && looping && beatPos >= loopEnd) {
             beatPos = loopStart + (beatPos - loopEnd);
@@ -1383,6 +1777,7 @@ void FILTRAudioProcessor::processBlockByType (AudioBuffer<FloatType>& buffer, ju
         for (auto& msg : midiIn) {
             if (msg.offset == 0) {
                 if (msg.isNoteon) {
+                    midiVelocity = msg.vel / 127.0;
                     if (msg.channel == triggerChn || triggerChn == 16) {
                         auto patidx = msg.note % 12;
                         queuePattern(patidx + 1);
@@ -1470,33 +1865,15 @@ void FILTRAudioProcessor::processBlockByType (AudioBuffer<FloatType>& buffer, ju
             }
         }
 
+        double viewx = xpos;
+
         // Sync mode
         if (trigger == Trigger::Sync) {
             xpos = sync > 0
                 ? beatPos / syncQN + phase
                 : ratePos + phase;
             xpos -= std::floor(xpos);
-
-            // read envelope follower offset contribution
-            auto coffset = cutoffset;
-            auto roffset = resoffset;
-            if (cutenvon || resenvon) {
-                auto result = getEnvelopeFollowerOffset(sample);
-                if (cutenvon)
-                    coffset += result[0] * cutenvamt;
-                if (resenvon)
-                    roffset += result[1] * resenvamt;
-            }
-
-            double newypos = getYcut(xpos, min, max, coffset);
-            ypos = value->process(newypos, newypos > ypos);
-            double newyres = getYres(xpos, min, max, roffset);
-            yres = resvalue->process(newyres, newyres > yres);
-
-            auto lsample = (double)upsampledBlock.getSample(0, sample);
-            auto rsample = (double)upsampledBlock.getSample(audioInputs == 1 ? 0 : 1, sample);
-            applyFilter(sample, ypos, yres, lsample, rsample);
-            processDisplaySample(sample, xpos, lsample, rsample);
+            viewx = xpos;
         }
 
         // MIDI mode
@@ -1520,44 +1897,12 @@ void FILTRAudioProcessor::processBlockByType (AudioBuffer<FloatType>& buffer, ju
                 }
             }
 
-            // read envelope follower offset contribution
-            auto coffset = cutoffset;
-            auto roffset = resoffset;
-            if (cutenvon || resenvon) {
-                auto result = getEnvelopeFollowerOffset(sample);
-                if (cutenvon)
-                    coffset += result[0] * cutenvamt;
-                if (resenvon)
-                    roffset += result[1] * resenvamt;
-            }
-
-            double newypos = getYcut(xpos, min, max, coffset);
-            ypos = value->process(newypos, newypos > ypos);
-            double newyres = getYres(xpos, min, max, roffset);
-            yres = resvalue->process(newyres, newyres > yres);
-
-            auto lsample = (double)upsampledBlock.getSample(0, sample);
-            auto rsample = (double)upsampledBlock.getSample(1 % audioInputs, sample);
-            applyFilter(sample, ypos, yres, lsample, rsample);
-            double viewx = (alwaysPlaying || midiTrigger) ? xpos : (trigpos + trigphase) - std::floor(trigpos + trigphase);
-            processDisplaySample(sample, viewx, lsample, rsample);
+            viewx = (alwaysPlaying || midiTrigger) ? xpos : (trigpos + trigphase) - std::floor(trigpos + trigphase);
         }
 
         // Audio mode
         else if (trigger == Trigger::Audio) {
-            // read the sample 'latency' samples ago
-            int latency = (int)latBufferL.size();
-            int readPos = (latpos + 1) % latency;
-            latBufferL[latpos] = upsampledBlock.getSample(0, sample);
-            latBufferR[latpos] = upsampledBlock.getSample(1, sample);
-            auto lsample = latBufferL[readPos];
-            auto rsample = latBufferR[readPos];
-
-            // write delayed samples to buffer to later apply dry/wet mix
-            for (int channel = 0; channel < 2; ++channel) {
-                upsampledBlock.setSample(channel, sample, channel == 0 ? lsample : rsample);
-            }
-
+            // the audio was already delayed by the lookahead before upsampling
             auto hit = audioTriggerCountdown == 0; // there was an audio transient trigger in this sample
 
             // envelope processing
@@ -1608,60 +1953,222 @@ void FILTRAudioProcessor::processBlockByType (AudioBuffer<FloatType>& buffer, ju
                 }
             }
 
-            // read envelope follower offset contribution
-            auto coffset = cutoffset;
-            auto roffset = resoffset;
-            if (cutenvon || resenvon) {
-                auto result = getEnvelopeFollowerOffset(sample);
-                if (cutenvon)
-                    coffset += result[0] * cutenvamt;
-                if (resenvon)
-                    roffset += result[1] * resenvamt;
-            }
-
-            double newypos = getYcut(xpos, min, max, coffset);
-            ypos = value->process(newypos, newypos > ypos);
-            double newyres = getYres(xpos, min, max, roffset);
-            yres = resvalue->process(newyres, newyres > yres);
-
-            applyFilter(sample, ypos, yres, lsample, rsample);
-
-            double viewx = (alwaysPlaying || audioTrigger) ? xpos : (trigpos + trigphase) - std::floor(trigpos + trigphase);
-            processDisplaySample(sample, viewx, lsample, rsample);
-            latpos = (latpos + 1) % latency;
+            viewx = (alwaysPlaying || audioTrigger) ? xpos : (trigpos + trigphase) - std::floor(trigpos + trigphase);
 
             if (audioTriggerCountdown > -1)
                 audioTriggerCountdown -= 1;
         }
 
-        xenv.store(xpos);
-        yenv.store(resonanceEditMode ? yres : ypos);
+        patcutsrc[sample] = 1.0 - pattern->get_y_at(xpos);
+        for (int band = 1; band < lmultibands; ++band)
+            bandCutBuf[band - 1][sample] = 1.0 - patterns[lbandPatterns[band - 1]]->get_y_at(xpos);
+        patressrc[sample] = 1.0 - respattern->get_y_at(xpos);
+        velsrc[sample] = midiVelocity;
+        viewBuf[sample] = viewx;
+
         beatPos += beatsPerSample;
         ratePos += 1 / (srate * samplingFactor) * ratehz;
+    }
+
+    // envelope followers pass
+    // the env followers process the dry audio buffer into a circular buffer
+    // an oversampled index matches the followers buffer latency samples ago and is interpolated here
+    {
+        double* cutenvsrc = modbus.getSource(ModBus::EnvCut);
+        double* resenvsrc = modbus.getSource(ModBus::EnvRes);
+        int size = (int)cutenvBuf.size();
+        int envlatency = outputCV ? 0 : oslatency;
+        for (int sample = 0; sample < numUpSamples; ++sample) {
+            double basePos = ((double)sample - envlatency) / samplingFactor;
+            int baseIndex = (int)std::floor(basePos);
+            double frac = basePos - baseIndex;
+            int index1 = ((envreadpos + baseIndex) % size + size) % size;
+            int index2 = (index1 + 1) % size;
+            cutenvsrc[sample] = cutenvBuf[index1] + frac * (cutenvBuf[index2] - cutenvBuf[index1]);
+            resenvsrc[sample] = resenvBuf[index1] + frac * (resenvBuf[index2] - resenvBuf[index1]);
+        }
+    }
+
+    // pattern capture, records the source amplitude against the view position at base rate
+    if (capture.isActive()) {
+        if ((int)captureBuf.size() < numSamples)
+            captureBuf.resize(numSamples, 0.0);
+        const double* cutenvsrc = modbus.getSource(ModBus::EnvCut);
+        const auto& src = sideInputs ? sideBuffer : doubleBuffer;
+        for (int sample = 0; sample < numSamples; ++sample) {
+            captureBuf[sample] = capture.source.load() == PatternCapture::CutEnv
+                ? cutenvsrc[sample * samplingFactor]
+                : std::max(std::fabs(src.getSample(0, sample)), std::fabs(src.getSample(1, sample)));
+        }
+        capture.process(viewBuf.data(), captureBuf.data(), numSamples, samplingFactor);
+    }
+
+    // routing pass, sources are summed into the destinations once per block
+    modbus.render(ModBus::Cutoff, min + cutoffset, numUpSamples);
+    modbus.add(ModBus::Cutoff, ModBus::PatCut, max - min, numUpSamples);
+    if (cutenvon) modbus.add(ModBus::Cutoff, ModBus::EnvCut, cutenvamt, numUpSamples);
+
+    // bands 2 to 4 share the cutoff routes but replace the pattern with their own
+    {
+        const double* cutsrc = modbus.getDest(ModBus::Cutoff);
+        for (int band = 1; band < lmultibands; ++band) {
+            double* bandcut = bandCutBuf[band - 1].data();
+            for (int sample = 0; sample < numUpSamples; ++sample)
+                bandcut[sample] = std::clamp(cutsrc[sample] + (max - min) * (bandcut[sample] - patcutsrc[sample]), 0.0, 1.0);
+        }
+    }
+    modbus.clip(ModBus::Cutoff, numUpSamples);
+
+    modbus.render(ModBus::Res, min + resoffset, numUpSamples);
+    modbus.add(ModBus::Res, ModBus::PatRes, max - min, numUpSamples);
+    if (resenvon) modbus.add(ModBus::Res, ModBus::EnvRes, resenvamt, numUpSamples);
+    modbus.clip(ModBus::Res, numUpSamples);
+
+    bool driveMod = modbus.isModulated(ModBus::Drive);
+    bool morphMod = modbus.isModulated(ModBus::Morph);
+    modbus.render(ModBus::Mix, mix, numUpSamples);
+    modbus.clip(ModBus::Mix, numUpSamples);
+    if (driveMod) {
+        modbus.render(ModBus::Drive, lfdrive, numUpSamples);
+        modbus.clip(ModBus::Drive, numUpSamples);
+    }
+    if (morphMod) {
+        modbus.render(ModBus::Morph, lfmorph, numUpSamples);
+        modbus.clip(ModBus::Morph, numUpSamples);
+    }
+
+    // smooth cutoff and resonance envelopes in place
+    double* cutdst = modbus.getDest(ModBus::Cutoff);
+    double* resdst = modbus.getDest(ModBus::Res);
+    for (int sample = 0; sample < numUpSamples; ++sample) {
+        ypos = value->process(cutdst[sample], cutdst[sample] > ypos);
+        cutdst[sample] = ypos;
+        yres = resvalue->process(resdst[sample], resdst[sample] > yres);
+        resdst[sample] = yres;
+    }
+    for (int band = 1; band < lmultibands; ++band) {
+        auto& smoother = bandValues[band - 1];
+        double& bandy = bandypos[band - 1];
+        double* bandcut = bandCutBuf[band - 1].data();
+        for (int sample = 0; sample < numUpSamples; ++sample) {
+            bandy = smoother.process(bandcut[sample], bandcut[sample] > bandy);
+            bandcut[sample] = bandy;
+        }
+    }
+
+    // stream the smoothed cutoff envelope as CC at base rate offsets
+    if (outputCC > 0) {
+        ccOutput.setup(outputCCChan + 1, outputCC - 1, outputCCMode, bipolarCC,
+            (int)std::round(srate * outputCCRate / 1000.0), outputCCDeadband);
+        ccOutput.process(midiMessages, cutdst, numSamples, samplingFactor);
+    }
 
+    // restore static drive and morph when their modulation is removed
+    if (!driveMod && modDriveActive) {
+        lFilter->setDrive(lfdrive);
+        rFilter->setDrive(lfdrive);
+        forEachBandFilter([this](Filter& f) { f.setDrive(lfdrive); });
+    }
+    if (!morphMod && modMorphActive) {
+        lFilter->setMorph(lfmorph);
+        rFilter->setMorph(lfmorph);
+        forEachBandFilter([this](Filter& f) { f.setMorph(lfmorph); });
+    }
+    modDriveActive = driveMod;
+    modMorphActive = morphMod;
+
+    lap(Profiler::Envelope);
+
+    // CV pass, writes the envelope at base rate and skips the filters and the downsampler
+    if (outputCV) {
+        for (int sample = 0; sample < numSamples; ++sample) {
+            double env = cutdst[sample * samplingFactor];
+            processDisplaySample(viewBuf[sample * samplingFactor], doubleBuffer.getSample(0, sample),
+                doubleBuffer.getSample(1, sample), env, env);
+            if (!useMonitor && !(cutenvon && cutenvMonitor) && !(resenvon && resenvMonitor)) {
+                for (int channel = 0; channel < audioOutputs; ++channel)
+                    buffer.setSample(channel, sample, static_cast<FloatType>(env));
+            }
+        }
+        lap(Profiler::Display);
+    }
+
+    // filter pass
+    double* drivedst = modbus.getDest(ModBus::Drive);
+    double* morphdst = modbus.getDest(ModBus::Morph);
+    double* mixdst = modbus.getDest(ModBus::Mix);
+    for (int sample = 0; !outputCV && sample < numUpSamples; ++sample) {
+        // drive and morph are updated at control rate, they are expensive to recalculate
+        if (sample % MOD_CONTROL_SAMPLES == 0) {
+            if (driveMod) {
+                double drive = drivedst[sample];
+                lFilter->setDrive(drive);
+                rFilter->setDrive(drive);
+                forEachBandFilter([drive](Filter& f) { f.setDrive(drive); });
+            }
+            if (morphMod) {
+                double morph = morphdst[sample];
+                lFilter->setMorph(morph);
+                rFilter->setMorph(morph);
+                forEachBandFilter([morph](Filter& f) { f.setMorph(morph); });
+            }
+        }
+
+        auto lsample = upd[0][sample];
+        auto rsample = upd[1][sample];
+        preAmpBuf[sample] = std::max(std::fabs(lsample), std::fabs(rsample));
+        applyFilter(sample, cutdst[sample], resdst[sample], lsample, rsample, mixdst[sample]);
     } // ============================================== END OF SAMPLES PROCESSING
+    lap(Profiler::Filter);
+
+    if (outputCV)
+        metering.push<FloatType>(Metering::Wet, nullptr, nullptr, numSamples);
+    else if (meterWet)
+        metering.push(Metering::Wet, wetBuffer.getReadPointer(0), wetBuffer.getReadPointer(1), numSamples);
+
+    // display pass, kept out of the filter loop so the filter stage is timed per block
+    for (int sample = 0; !outputCV && sample < numUpSamples; ++sample) {
+        processDisplaySample(viewBuf[sample], preAmpBuf[sample], preAmpBuf[sample], upd[0][sample], upd[1][sample]);
+    }
+    if (!outputCV)
+        lap(Profiler::Display);
+
+    xenv.store(xpos);
+    yenv.store(resonanceEditMode ? yres : ypos);
 
     drawSeek.store(playing && (trigger == Trigger::Sync || midiTrigger || audioTrigger)); // informs UI if it should seek or not, typically only during play
-    oversampler.processSamplesDown(block);
+    if (!outputCV)
+        oversampler.processSamplesDown(block);
 
     // write processed buffer into the output unless the user is monitoring some input like dry signal or sidechain
-    if (!useMonitor && !(cutenvon && cutenvMonitor) && !(resenvon && resenvMonitor)) {
+    if (!outputCV && !useMonitor && !(cutenvon && cutenvMonitor) && !(resenvon && resenvMonitor)) {
         for (int channel = 0; channel < audioOutputs; ++channel) {
-            auto* src = doubleBuffer.getReadPointer(channel);
             auto* dst = buffer.getWritePointer(channel);
+            auto* src = doubleBuffer.getReadPointer(channel);
             for (int sample = 0; sample < buffer.getNumSamples(); ++sample)
                 dst[sample] = static_cast<FloatType>(src[sample]);
         }
     }
 
-    // store rms values to be displayed by the UI
-    rmsLeft.store(0.8 * rmsLeft.load() + 0.2 * (double)buffer.getRMSLevel(0, 0, numSamples));
-    rmsRight.store(0.8 * rmsRight.load() + 0.2 * (double)buffer.getRMSLevel(audioOutputs > 1 ? 1 : 0, 0, numSamples));
+    lap(Profiler::Downsample);
+
+    // output levels are computed by the UI from the metering ring
+    metering.push(Metering::Output, buffer.getReadPointer(0), buffer.getReadPointer(audioOutputs > 1 ? 1 : 0), numSamples);
 
     // store last written values
     // used to reset filters at the beggining of a block
     lastOutL = buffer.getSample(0, numSamples - 1);
     lastOutR = buffer.getSample(audioOutputs == 1 ? 0 : 1, numSamples - 1);
+
+    if (autoQuality) {
+        auto elapsed = Time::highResolutionTicksToSeconds(Time::getHighResolutionTicks() - startTicks);
+        governor.update(elapsed, numSamples, srate);
+    }
+
+    if (profiling) {
+        profiler.lap(Profiler::Setup);
+        profiler.end(numSamples, srate, outputCV ? -1 : (int)lftype);
+    }
 }
 
 //==============================================================================
@@ -1678,6 +2185,19 @@ juce::AudioProcessorEditor* FILTRAudioProcessor::createEditor()
 //==============================================================================
 void FILTRAudioProcessor::getStateInformation (juce::MemoryBlock& destData)
 {
+    // patterns of a restore still being parsed are saved from their restored text
+    std::vector<std::string> pending;
+    std::string pendingSeqCells;
+    bool pendingSeqHasCells = false;
+    {
+        std::lock_guard<std::mutex> lock(restoreMtx);
+        if (installedGeneration.load() != restoreGeneration.load()) {
+            pending = pendingPatterns; // installed slots are empty
+            pendingSeqHasCells = pendingHasCells;
+            pendingSeqCells = pendingCells;
+        }
+    }
+
     auto state = ValueTree("PluginState");
     state.appendChild(params.copyState(), nullptr);
     state.setProperty("version", PROJECT_VERSION, nullptr);
@@ -1694,6 +2214,9 @@ void FILTRAudioProcessor::getStateInformation (juce::MemoryBlock& destData)
     state.setProperty("outputCV", outputCV, nullptr);
     state.setProperty("outputATMIDI", outputATMIDI, nullptr);
     state.setProperty("bipolarCC", bipolarCC, nullptr);
+    state.setProperty("outputCCMode", outputCCMode, nullptr);
+    state.setProperty("outputCCRate", outputCCRate, nullptr);
+    state.setProperty("outputCCDeadband", outputCCDeadband, nullptr);
     state.setProperty("paintTool", paintTool, nullptr);
     state.setProperty("paintPage", paintPage, nullptr);
     state.setProperty("pointMode", pointMode, nullptr);
@@ -1703,6 +2226,14 @@ void FILTRAudioProcessor::getStateInformation (juce::MemoryBlock& destData)
     state.setProperty("resenvSidechain", resenvSidechain, nullptr);
     state.setProperty("resenvAutoRel", resenvAutoRel, nullptr);
     state.setProperty("linkSeqToGrid", linkSeqToGrid, nullptr);
+    state.setProperty("autoQuality", autoQuality, nullptr);
+    state.setProperty("multibands", multibands, nullptr);
+    for (int i = 0; i < Crossover::kMaxBands - 1; ++i) {
+        state.setProperty("crossover" + String(i), crossoverFreqs[i], nullptr);
+        state.setProperty("bandftype" + String(i + 2), bandFilterTypes[i], nullptr);
+        state.setProperty("bandpat" + String(i + 2), bandPatterns[i], nullptr);
+    }
+    state.setProperty("modmatrix", modbus.serialize(), nullptr);
     state.setProperty("currpattern", pattern->index + 1, nullptr);
     state.setProperty("currrespattern", respattern->index - 12 + 1, nullptr);
 
@@ -1718,7 +2249,7 @@ void FILTRAudioProcessor::getStateInformation (juce::MemoryBlock& destData)
         for (const auto& point : points) {
             oss << point.x << " " << point.y << " " << point.tension << " " << point.type << " ";
         }
-        state.setProperty("pattern" + juce::String(i), var(oss.str()), nullptr);
+        state.setProperty("pattern" + juce::String(i), var(pending.empty() || pending[i].empty() ? oss.str() : pending[i]), nullptr);
 
         points = respatterns[i]->points;
 
@@ -1729,7 +2260,7 @@ void FILTRAudioProcessor::getStateInformation (juce::MemoryBlock& destData)
         for (const auto& point : points) {
             ossres << point.x << " " << point.y << " " << point.tension << " " << point.type << " ";
         }
-        state.setProperty("respattern" + juce::String(i), var(ossres.str()), nullptr);
+        state.setProperty("respattern" + juce::String(i), var(pending.empty() || pending[i + 12].empty() ? ossres.str() : pending[i + 12]), nullptr);
     }
 
     // serialize sequencer cells
@@ -1747,7 +2278,7 @@ void FILTRAudioProcessor::getStateInformation (juce::MemoryBlock& destData)
             << cell.tenrel << ' '
             << cell.skew << '\n';
     }
-    state.setProperty("seqcells", var(oss.str()), nullptr);
+    state.setProperty("seqcells", var(pendingSeqHasCells ? pendingSeqCells : oss.str()), nullptr);
 
     std::unique_ptr<juce::XmlElement> xml(state.createXml());
     copyXmlToBinary(*xml, destData);
@@ -1776,6 +2307,9 @@ void FILTRAudioProcessor::setStateInformation (const void* data, int sizeInBytes
         outputCC = (int)state.getProperty("outputCC");
         outputCCChan = (int)state.getProperty("outputCCChan");
         bipolarCC = (bool)state.getProperty("bipolarCC");
+        outputCCMode = state.hasProperty("outputCCMode") ? (int)state.getProperty("outputCCMode") : 0;
+        outputCCRate = state.hasProperty("outputCCRate") ? (int)state.getProperty("outputCCRate") : 0;
+        outputCCDeadband = state.hasProperty("outputCCDeadband") ? (double)state.getProperty("outputCCDeadband") : 0.0;
         outputCV = (bool)state.getProperty("outputCV");
         outputATMIDI = (int)state.getProperty("outputATMIDI");
         paintTool = (int)state.getProperty("paintTool");
@@ -1788,6 +2322,20 @@ void FILTRAudioProcessor::setStateInformation (const void* data, int sizeInBytes
         resenvAutoRel = (bool)state.getProperty("resenvAutoRel");
         midiTriggerChn = (int)state.getProperty("midiTriggerChn");
         linkSeqToGrid = state.hasProperty("linkSeqToGrid") ? (bool)state.getProperty("linkSeqToGrid") : true;
+        autoQuality = state.hasProperty("autoQuality") ? (bool)state.getProperty("autoQuality") : false;
+        if (!autoQuality) governor.reset();
+        multibands = state.hasProperty("multibands") ? (int)state.getProperty("multibands") : 0;
+        static const double defaultCrossovers[] = { 200.0, 1000.0, 5000.0 };
+        for (int i = 0; i < Crossover::kMaxBands - 1; ++i) {
+            auto xover = "crossover" + String(i);
+            auto ftype = "bandftype" + String(i + 2);
+            auto patidx = "bandpat" + String(i + 2);
+            crossoverFreqs[i] = state.hasProperty(xover) ? (double)state.getProperty(xover) : defaultCrossovers[i];
+            bandFilterTypes[i] = state.hasProperty(ftype) ? (int)state.getProperty(ftype) : (int)kLinear12;
+            bandPatterns[i] = state.hasProperty(patidx) ? (int)state.getProperty(patidx) : i + 1;
+        }
+        markDirty(DirtyAll); // non parameter state (smooth, envelopes, bands) was replaced too
+        modbus.deserialize(state.hasProperty("modmatrix") ? state.getProperty("modmatrix").toString() : String());
 
         int currpattern = state.hasProperty("currpattern")
             ? (int)state.getProperty("currpattern")
@@ -1805,64 +2353,133 @@ void FILTRAudioProcessor::setStateInformation (const void* data, int sizeInBytes
             param->setValueNotifyingHost(param->convertTo0to1((float)currrespattern));
         }
 
+        // restore the playing and band patterns now so the envelope is usable right away
+        // the remaining patterns are cleared, they and the sequencer cells are parsed on a background thread
+        int generation = ++restoreGeneration;
+        int cutidx = jlimit(1, 12, currpattern) - 1;
+        int residx = (bool)params.getRawParameterValue("linkpats")->load()
+            ? cutidx
+            : jlimit(1, 12, state.hasProperty("currrespattern") ? (int)state.getProperty("currrespattern") : (int)params.getRawParameterValue("respattern")->load()) - 1;
+
+        std::vector<std::string> strs(24);
         for (int i = 0; i < 12; ++i) {
-            patterns[i]->clear();
             patterns[i]->clearUndo();
-            respatterns[i]->clear();
             respatterns[i]->clearUndo();
+            strs[i] = state.getProperty("pattern" + String(i)).toString().toStdString();
+            strs[i + 12] = state.getProperty("respattern" + String(i)).toString().toStdString();
+        }
 
-            auto str = state.getProperty("pattern" + String(i)).toString().toStdString();
-            if (!str.empty()) {
-                double x, y, tension;
-                int type;
-                std::istringstream iss(str);
-                while (iss >> x >> y >> tension >> type) {
-                    patterns[i]->insertPoint(x,y,tension,type);
-                }
-            }
-
-            str = state.getProperty("respattern" + String(i)).toString().toStdString();
-            if (!str.empty()) {
-                double x, y, tension;
-                int type;
-                std::istringstream iss(str);
-                while (iss >> x >> y >> tension >> type) {
-                    respatterns[i]->insertPoint(x,y,tension,type);
-                }
-            }
+        std::vector<bool> installed(24, false);
+        installed[cutidx] = true;
+        installed[residx + 12] = true;
+        for (int i = 0; i < multibands - 1; ++i)
+            installed[jlimit(0, 11, bandPatterns[i])] = true;
 
-            auto tension = (double)params.getRawParameterValue("tension")->load();
-            auto tensionatk = (double)params.getRawParameterValue("tensionatk")->load();
-            auto tensionrel = (double)params.getRawParameterValue("tensionrel")->load();
-            patterns[i]->setTension(tension, tensionatk, tensionrel, dualTension);
-            patterns[i]->buildSegments();
-            respatterns[i]->setTension(tension, tensionatk, tensionrel, dualTension);
-            respatterns[i]->buildSegments();
+        {
+            // a switch to a slot still being parsed plays an empty pattern instead of the previous state points
+            std::lock_guard<std::mutex> lock(restoreMtx);
+            for (int i = 0; i < 24; ++i)
+                installPattern(i < 12 ? patterns[i] : respatterns[i - 12], installed[i] ? parsePoints(strs[i]) : std::vector<PPoint>());
+
+            pendingPatterns = strs;
+            for (int i = 0; i < 24; ++i)
+                if (installed[i]) pendingPatterns[i].clear();
+            pendingInstalled = installed;
+            pendingHasCells = state.hasProperty("seqcells");
+            pendingCells = pendingHasCells ? state.getProperty("seqcells").toString().toStdString() : "";
         }
-
         updatePatternFromRes();
         updatePatternFromCutoff();
 
-        if (state.hasProperty("seqcells")) {
-            auto str = state.getProperty("seqcells").toString().toStdString();
-            sequencer->cells.clear();
-            std::istringstream iss(str);
-            Cell cell;
-            int shape, lshape;
-            while (iss >> shape >> lshape >> cell.ptool >> cell.invertx
-                >> cell.minx >> cell.maxx >> cell.miny >> cell.maxy >> cell.tenatt
-                >> cell.tenrel >> cell.skew)
-            {
-                cell.shape = static_cast<CellShape>(shape);
-                cell.lshape = static_cast<CellShape>(lshape);
-                sequencer->cells.push_back(cell);
-            }
-        }
+        // the job only touches its copies, the instance may be gone when it runs
+        auto weakThis = WeakReference<FILTRAudioProcessor>(this);
+        restorePool->pool.addJob([weakThis, generation, texts = pendingPatterns, cellsText = pendingCells] {
+            std::vector<std::vector<PPoint>> pats(texts.size());
+            for (size_t i = 0; i < texts.size(); ++i)
+                pats[i] = parsePoints(texts[i]);
+            auto seqcells = parseCells(cellsText);
+            MessageManager::callAsync([weakThis, generation, pats = std::move(pats), seqcells = std::move(seqcells)] {
+                if (auto* processor = weakThis.get())
+                    processor->installRestore(generation, pats, seqcells);
+            });
+        });
     }
 
     setUIMode(Normal);
 }
 
+std::vector<PPoint> FILTRAudioProcessor::parsePoints(const std::string& str)
+{
+    std::vector<PPoint> points;
+    if (str.empty())
+        return points;
+
+    double x, y, tension;
+    int type;
+    std::istringstream iss(str);
+    while (iss >> x >> y >> tension >> type) {
+        points.push_back({ 0, x, y, tension, type });
+    }
+    return points;
+}
+
+std::vector<Cell> FILTRAudioProcessor::parseCells(const std::string& str)
+{
+    std::vector<Cell> cells;
+    std::istringstream iss(str);
+    Cell cell;
+    int shape, lshape;
+    while (iss >> shape >> lshape >> cell.ptool >> cell.invertx
+        >> cell.minx >> cell.maxx >> cell.miny >> cell.maxy >> cell.tenatt
+        >> cell.tenrel >> cell.skew)
+    {
+        cell.shape = static_cast<CellShape>(shape);
+        cell.lshape = static_cast<CellShape>(lshape);
+        cells.push_back(cell);
+    }
+    return cells;
+}
+
+void FILTRAudioProcessor::installPattern(Pattern* pat, const std::vector<PPoint>& points)
+{
+    auto tension = (double)params.getRawParameterValue("tension")->load();
+    auto tensionatk = (double)params.getRawParameterValue("tensionatk")->load();
+    auto tensionrel = (double)params.getRawParameterValue("tensionrel")->load();
+    pat->clear();
+    pat->insertPoints(points);
+    pat->setTension(tension, tensionatk, tensionrel, dualTension);
+    pat->buildSegments();
+}
+
+/*
+    Second stage of setStateInformation, installs the patterns parsed in the background
+    Runs on the message thread, skipped when a newer state was set meanwhile
+*/
+void FILTRAudioProcessor::installRestore(int generation, const std::vector<std::vector<PPoint>>& pats, const std::vector<Cell>& cells)
+{
+    std::lock_guard<std::mutex> lock(restoreMtx);
+    if (generation != restoreGeneration.load() || installedGeneration.load() == generation)
+        return;
+
+    for (int i = 0; i < 24; ++i) {
+        if (!pendingInstalled[i])
+            installPattern(i < 12 ? patterns[i] : respatterns[i - 12], pats[i]);
+    }
+
+    if (pendingHasCells) {
+        sequencer->cells = cells;
+        if (sequencer->isOpen)
+            sequencer->build();
+    }
+
+    pendingPatterns.clear();
+    pendingCells.clear();
+    installedGeneration.store(generation);
+    updatePatternFromRes();
+    updatePatternFromCutoff();
+    sendChangeMessage();
+}
+
 void FILTRAudioProcessor::importPatterns()
 {
     if (sequencer->isOpen)
@@ -27,7 +27,18 @@
 #include "ui/Sequencer.h"
 #include "dsp/Utils.h"
 #include "dsp/Follower.h"
+#include "dsp/FilterBank.h"
+#include "dsp/Crossover.h"
+#include "dsp/QualityGovernor.h"
+#include "dsp/Profiler.h"
+#include "dsp/ModBus.h"
+#include "dsp/CCOutput.h"
+#include "dsp/PatternCapture.h"
+#include "dsp/Metering.h"
 #include "utils/PatternManager.h"
+#include "utils/PatternLibrary.h"
+#include "utils/SharedSettings.h"
+#include "utils/SharedThreadPool.h"
 
 using namespace globals;
 
@@ -114,6 +125,7 @@ class FILTRAudioProcessor
     : public AudioProcessor
     , public AudioProcessorParameter::Listener
     , public ChangeBroadcaster
+    , private ChangeListener
     , private AudioProcessorValueTreeState::Listener
 {
 public:
@@ -142,11 +154,19 @@ public:
     int outputCCChan = 0; // output CC channel, 0 is channel 1
     int outputATMIDI = 0; // audio trigger midi note output, 0 is off, 60 is C4
     bool bipolarCC = false;
+    int outputCCMode = 0; // 0 7-bit CC, 1 14-bit CC pair, 2 NRPN
+    int outputCCRate = 0; // millis between CC messages, 0 sends once per block
+    double outputCCDeadband = 0.0; // minimum normalized change before sending a new CC value
     bool outputCV = false;
     int paintTool = 0; // index of pattern used for paint mode
     int paintPage = 0;
     int pointMode = 1; // Hold, Curve, S-curve, Pulse, Wave etc..
     int linkSeqToGrid = true; // sequencer step linked to grid size
+    bool autoQuality = false; // lower processing quality automatically under sustained cpu load
+    int multibands = 0; // multiband mode band count, 0 is off, 2 to 4 splits the input with the crossover
+    double crossoverFreqs[Crossover::kMaxBands - 1] = { 200.0, 1000.0, 5000.0 };
+    int bandFilterTypes[Crossover::kMaxBands - 1] = { kLinear12, kLinear12, kLinear12 }; // filters of bands 2 to 4, band 1 uses ftype
+    int bandPatterns[Crossover::kMaxBands - 1] = { 1, 2, 3 }; // cutoff patterns of bands 2 to 4, band 1 uses the active pattern
 
     // State
     Pattern* pattern; // current pattern used for audio processing
@@ -167,6 +187,7 @@ public:
     double trigphase = 0.0; // phase when trigger occurs, used to sync the background wave draw
     double syncQN = 1.0; // sync quarter notes
     int ltrigger = -1; // last trigger mode
+    bool loutputCV = false; // last CV output mode
     bool midiTrigger = false; // flag midi has triggered envelope
     int winpos = 0;
     int lwinpos = 0;
@@ -189,6 +210,15 @@ public:
     double lfdrive = -1.0;
     double lfmorph = -1.0;
     juce::dsp::LadderFilter<double> ladderFilter;
+    Crossover crossover; // multiband mode band splitter, runs at the oversampled rate
+    std::unique_ptr<Filter> bandFiltersL[Crossover::kMaxBands - 1]; // filters of bands 2 to 4, null while the band is off
+    std::unique_ptr<Filter> bandFiltersR[Crossover::kMaxBands - 1];
+    int lmultibands = 0;
+    int lbandFilterTypes[Crossover::kMaxBands - 1] = { -1, -1, -1 };
+    int lbandPatterns[Crossover::kMaxBands - 1] = { -1, -1, -1 };
+    RCSmoother bandValues[Crossover::kMaxBands - 1]; // smooths the cutoff envelopes of bands 2 to 4
+    double bandypos[Crossover::kMaxBands - 1] = {};
+    std::vector<double> bandCutBuf[Crossover::kMaxBands - 1]; // oversampled cutoff envelopes of bands 2 to 4, sized in prepareToPlay
     double lastOutL = 0.0; // used for smoothly transition filter types
     double lastOutR = 0.0;
     bool cutoffDirty = false;
@@ -196,28 +226,53 @@ public:
     bool resDirty = false;
     int resDirtyCooldown = 0;
 
+    // Quality governor state
+    QualityGovernor governor;
+    int lqualityTier = 0; // last quality tier applied to filters
+    int coeffCounter = 0; // samples since last filter coefficients update
+    int displayCounter = 0; // samples since last display capture
+    Profiler profiler; // per stage timing counters, only active while enabled from the UI
+
     // Audio mode state
     bool audioTrigger = false; // flag audio has triggered envelope
     int audioTriggerCountdown = -1; // samples until audio envelope starts
-    std::vector<double> latBufferL; // latency buffer left
-    std::vector<double> latBufferR; // latency buffer right
+    std::vector<double> latBufferL; // base rate lookahead ring left
+    std::vector<double> latBufferR; // base rate lookahead ring right
+    juce::AudioBuffer<double> lookaheadBuffer; // delayed dry block fed to the upsampler
+    juce::AudioBuffer<double> sideBuffer; // sidechain block, silent when there is no sidechain bus
+    juce::AudioBuffer<double> wetBuffer; // filtered block after gain and before the mix, filled while a meter is showing
     std::vector<double> monLatBufferL; // latency monitor buffer left
     std::vector<double> monLatBufferR; // latency monitor buffer right
-    int latpos = 0; // latency buffer pos
+    int latpos = 0; // lookahead ring pos
     int monWritePos = 0; // monitor latency pos
-    RBJ lpFilterL{};
-    RBJ lpFilterR{};
-    RBJ hpFilterL{};
-    RBJ hpFilterR{};
     double lastHitAmplitude = 0.0; // used to display transient hits on monitor view
 
+    // Silence bypass state
+    int64_t silentSamples = 0; // consecutive input samples below SILENCE_THRESHOLD
+
     // Envelope follower State
     Follower cutenv;
     Follower resenv;
+    FilterBank filterBank; // band limits the followers and transient detector inputs
+    std::vector<double> envBlock; // follower output for the current block before it is written to the circular buffers
     std::vector<double> cutenvBuf; // because env followers are processed on non oversampled inputs, they have to be buffered
     std::vector<double> resenvBuf;
     int envreadpos = 0;
     int envwritepos = 0;
+
+    // Modulation state
+    ModBus modbus; // block rendered modulation sources routed to filter destinations
+    std::vector<double> viewBuf; // per sample envelope x position drawn by the view
+    std::vector<double> preAmpBuf; // per sample dry amplitude drawn by the view
+    double midiVelocity = 0.0; // last MIDI note on velocity, modulation source
+    bool modDriveActive = false; // drive was modulated on the last block
+    bool modMorphActive = false;
+    CCOutput ccOutput; // sub block CC stream of the cutoff envelope
+    PatternCapture capture; // records an envelope cycle into the view pattern
+    PatternLibrary library; // indexed folder of .12pat files browsed from the UI
+    String libraryFolder; // library folder shared by all instances through user settings
+    bool captureContinuous = false; // capture every cycle until stopped
+    std::vector<double> captureBuf; // capture source amplitude per block sample
     // Envelope follower Settings
     bool cutenvMonitor = false;
     bool cutenvSidechain = false;
@@ -257,13 +312,30 @@ public:
     bool showSequencer = false;
     bool resonanceEditMode = false;
     bool showEnvelopeKnobs = false;
-    std::atomic<double> rmsLeft = 0.0;
-    std::atomic<double> rmsRight = 0.0;
+    Metering metering; // input, wet and output levels, drained by the meter
+
+    // parameter groups, a parameter change marks its group dirty
+    // and the next block only runs the updates of the dirty groups
+    enum DirtyFlags : uint32_t {
+        DirtySmooth = 1 << 0, // smooth, attack and release
+        DirtyTrigger = 1 << 1, // trigger mode and CV output, updates the latency
+        DirtyTension = 1 << 2,
+        DirtySync = 1 << 3,
+        DirtyFilterType = 1 << 4,
+        DirtyFilterParams = 1 << 5, // filter mode, lerp, drive and morph
+        DirtyCutoff = 1 << 6,
+        DirtyRes = 1 << 7,
+        DirtyCutEnv = 1 << 8,
+        DirtyResEnv = 1 << 9,
+        DirtyMultiband = 1 << 10,
+        DirtyAll = 0xffffffff
+    };
 
     //==============================================================================
     FILTRAudioProcessor();
     ~FILTRAudioProcessor() override;
     void parameterChanged (const juce::String& parameterID, float newValue) override;
+    void changeListenerCallback (ChangeBroadcaster* source) override;
 
     void loadSettings();
     void saveSettings();
@@ -271,7 +343,8 @@ public:
     int getCurrentGrid();
     int getCurrentSeqStep();
     void createUndoPoint(int patindex = -1);
-    void createUndoPointFromSnapshot(std::vector<PPoint> snapshot);
+    void createUndoPointFromSnapshot(const std::vector<PPoint>& snapshot);
+    void replaceViewPattern(const std::vector<PPoint>& points);
     void setUIMode(UIMode mode);
     void togglePaintEditMode();
     void togglePaintMode();
@@ -280,6 +353,9 @@ public:
     void setViewPattern(int index);
     void restorePaintPatterns();
     void resetFilters(double srate);
+    void applyLookahead(const AudioBuffer<double>& input, AudioBuffer<double>& output, int numSamples);
+    void resetBandFilters(double srate, bool force = false);
+    std::unique_ptr<Filter> createFilter(int ftype);
     void setResonanceEditMode(bool isResonance);
     void startMidiTrigger();
 
@@ -295,20 +371,25 @@ public:
    #endif
 
     //==============================================================================
-    void onSlider ();
+    void onSlider (uint32_t dirty = DirtyAll); // applies the updates of the dirty groups
+    void markDirty(uint32_t flags) { dirtyFlags.fetch_or(flags); } // any thread, applied at the start of the next block
     void updatePatternFromCutoff();
     void updatePatternFromRes();
     void updateCutoffFromPattern();
     void updateResFromPattern();
     void onTensionChange();
+    void applyPaintTension(); // message thread, applies a tension change left by the audio thread to the paint patterns
     void onPlay ();
     void onStop ();
     void restartEnv (bool fromZero = false);
     void onSmoothChange();
     void clearWaveBuffers();
+    int getTargetLatency(int trigger, double srate); // latency reported to the host for a trigger mode
     void clearLatencyBuffers();
     double getYcut(double x, double min, double max, double offset);
     double getYres(double x, double min, double max, double offset);
+    bool canBypassBlock(const MidiBuffer& midiMessages, int numSamples);
+    void advanceEnvelope(int numSamples);
     void queuePattern(int patidx);
     void queueResPattern(int patidx);
 
@@ -342,23 +423,59 @@ public:
     void setStateInformation (const void* data, int sizeInBytes) override;
     void exportPatterns();
     void importPatterns();
+    static std::vector<PPoint> parsePoints(const std::string& str); // parses a pattern line of points in x y tension type groups
     //=========================================================
 
     AudioProcessorValueTreeState params;
     UndoManager undoManager;
 
 private:
+    UndoBudget undoBudget { UNDO_BUDGET_BYTES }; // shared by all patterns and sequencer undo stacks
     Pattern* patterns[12]; // audio process cutoff patterns
     Pattern* respatterns[12]; // audio process resonance patterns
     Pattern* paintPatterns[PAINT_PATS]; // paint mode patterns
+
+    // Lazy state restore
+    SharedResourcePointer<SharedThreadPool> restorePool; // parses restored patterns off the message thread
+    std::atomic<int> restoreGeneration = 0; // incremented on every setStateInformation
+    std::atomic<int> installedGeneration = 0; // last restore with all patterns installed
+    std::mutex restoreMtx;
+    std::vector<std::string> pendingPatterns; // text of restored patterns, 12 cut followed by 12 res
+    std::vector<bool> pendingInstalled; // patterns installed by the first restore stage, the others are cleared until installed
+    std::string pendingCells;
+    bool pendingHasCells = false;
+    static std::vector<Cell> parseCells(const std::string& str);
+    void installPattern(Pattern* pat, const std::vector<PPoint>& points);
+    void installRestore(int generation, const std::vector<std::vector<PPoint>>& pats, const std::vector<Cell>& cells);
     Transient transDetectorL;
     Transient transDetectorR;
-    bool paramChanged = false; // flag that triggers on any param change
-    ApplicationProperties settings;
+    std::atomic<uint32_t> dirtyFlags = DirtyAll; // groups changed since the last block
+    std::vector<uint32_t> paramDirtyFlags; // dirty groups of each parameter index, parameters read per block have none
+    std::atomic<bool> paintTensionPending = false; // set when tension changed off the message thread
+    void updatePaintTension();
+    void updateSync();
+    void updateFilters(uint32_t dirty);
+    void updateCutoff();
+    void updateRes();
+    void updateCutEnv();
+    void updateResEnv();
+    SharedResourcePointer<SharedSettings> sharedSettings; // user settings and paint patterns shared by all instances
+    SharedSettings::Points paintSources[PAINT_PATS]; // shared point sets last installed into or published from paintPatterns
     std::vector<MidiInMsg> midiIn; // midi buffer used to process midi messages offset
     std::vector<MidiOutMsg> midiOut;
     PatternManager patternManager;
 
+    template <typename Fn>
+    void forEachBandFilter(Fn fn) // applies fn to the left and right filters of the active bands 2 to 4
+    {
+        for (int i = 0; i < Crossover::kMaxBands - 1; ++i) {
+            if (bandFiltersL[i] == nullptr) continue;
+            fn(*bandFiltersL[i]);
+            fn(*bandFiltersR[i]);
+        }
+    }
+
     //==============================================================================
+    JUCE_DECLARE_WEAK_REFERENCEABLE (FILTRAudioProcessor) // async callbacks may outlive the processor
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (FILTRAudioProcessor)
 };
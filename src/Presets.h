@@ -1,156 +1,232 @@
 #pragma once
 
 #include "dsp/Pattern.h"
-#include <vector>
-#include <string>
-#include <sstream>
+#include <iterator>
 
-class Presets {
-public:
-	static std::vector<PPoint> getCutPreset(int index) {
-		const auto& presets = getCutPresets();
-		if (index < 0 || index >= static_cast<int>(presets.size()))
-			return {};
-		return parsePreset(presets[index]);
-	}
+/*
+	Factory presets as constant point tables compiled into the binary
+	Loading a preset copies the table into a pattern, no text is parsed
+	Points are stored in x y tension type order with id 0, ids are assigned when inserted into a pattern
+*/
+namespace presets {
 
-	static std::vector<PPoint> getResPreset(int index) {
-		const auto& presets = getResPresets();
-		if (index < 0 || index >= static_cast<int>(presets.size()))
-			return {};
-		return parsePreset(presets[index]);
-	}
+	// Paint mode presets
+	inline constexpr PPoint paint0[] = { { 0, 0, 1, 0, 1 }, { 0, 1, 0, 0, 1 } }; // line
+	inline constexpr PPoint paint1[] = { { 0, 0.005, 1, 0, 1 }, { 0, 0.995, 0, 0, 1 } }; // Saw
+	inline constexpr PPoint paint2[] = { { 0, 0, 1, 0, 1 }, { 0, 0.5, 0, 0, 1 }, { 0, 1, 1, 0, 1 } }; // triangle
+	inline constexpr PPoint paint3[] = { { 0, 0.005, 1, 0, 3 }, { 0, 0.995, 0, 0, 1 } }; // square
+	inline constexpr PPoint paint4[] = { { 0, 0, 1, -0.302, 1 }, { 0, 0.5, 0, -0.37, 1 }, { 0, 1, 1, 0, 1 } }; // Fin
+	inline constexpr PPoint paint5[] = { { 0, 0.005, 1, 0.35, 2 }, { 0, 0.995, 0, 0, 1 } }; // S-Curve
+	inline constexpr PPoint paint6[] = { { 0, 0.25, 1, 0.2, 2 }, { 0, 0.75, 0, 0.2, 2 } }; // sine
+	inline constexpr PPoint paint7[] = { { 0, 0, 1, 0, 1 }, { 0, 0, 0, -0.25, 1 }, { 0, 0.25, 1, 0, 1 }, { 0, 0.25, 0.375, -0.25, 1 }, { 0, 0.5, 1, 0, 1 }, { 0, 0.5, 0, -0.25, 1 }, { 0, 0.75, 1, 0, 1 }, { 0, 0.75, 0.375, -0.25, 1 }, { 0, 1, 1, 0, 1 } }; // waves
 
-	static std::vector<PPoint> getPaintPreset(int index) {
-		const auto& presets = getPaintPresets();
-		if (index < 0 || index >= static_cast<int>(presets.size()))
-			return {};
-		return parsePreset(presets[index]);
-	}
+	// Cutoff presets
+	inline constexpr PPoint cut1[] = { { 0, 0.25, 0.75, 0, 1 }, { 0, 0.75, 0.25, 0, 1 } };
+	inline constexpr PPoint cut2[] = { { 0, 1e-08, 0.625, 0, 1 }, { 0, 0.125, 0.625, 0, 1 }, { 0, 0.125, 0.75, 0, 1 }, { 0, 0.25, 0.75, 0, 1 }, { 0, 0.25, 0.4375, 0, 1 }, { 0, 0.375, 0.4375, 0, 1 }, { 0, 0.375, 0.75, 0, 1 }, { 0, 0.5, 0.75, 0, 1 }, { 0, 0.5, 0.25, 0.02, 1 }, { 0, 0.625, 0.25, 0, 1 }, { 0, 0.625, 0.75, 0, 1 }, { 0, 0.75, 0.75, 0, 1 }, { 0, 0.75, 0.75, 0, 1 }, { 0, 0.75, 0.25, 0, 1 }, { 0, 0.875, 0.25, 0, 1 }, { 0, 0.875, 0.5, 0, 1 }, { 0, 1, 0.5, 0, 1 } };
+	inline constexpr PPoint cut3[] = { { 0, 1e-08, 0.75, 0, 1 }, { 0, 0.0147541, 0.307372, 0, 1 }, { 0, 0.25, 0.75, 0, 1 }, { 0, 0.25, 0.75, 0, 1 }, { 0, 0.3125, 0.75, 0, 1 }, { 0, 0.3125, 0.75, 0, 1 }, { 0, 0.321311, 0.44359, 0, 1 }, { 0, 0.375, 0.75, 0, 1 }, { 0, 0.375, 0.75, 0, 1 }, { 0, 0.381967, 0.435897, 0, 1 }, { 0, 0.4375, 0.75, 0, 1 }, { 0, 0.5, 0.75, 0.125, 1 }, { 0, 0.514754, 0.307372, -0.125, 1 }, { 0, 0.75, 0.75, -0.125, 1 }, { 0, 0.8125, 0.75, 0, 1 }, { 0, 0.827254, 0.369872, 0, 1 }, { 0, 0.875, 0.75, 0, 1 }, { 0, 0.875, 0.75, 0, 1 }, { 0, 0.890164, 0.5, 0, 1 }, { 0, 0.9375, 0.75, 0, 1 }, { 0, 0.9375, 0.75, 0, 1 }, { 0, 0.94918, 0.533333, 0, 1 }, { 0, 1, 0.75, 0, 1 } };
+	inline constexpr PPoint cut4[] = { { 0, 1e-08, 0.6875, 0, 1 }, { 0, 2e-08, 0.625, 0, 1 }, { 0, 0.0625, 0.6875, 0, 1 }, { 0, 0.0625, 0.6875, -0.125, 1 }, { 0, 0.0625, 0.374038, 0.125, 1 }, { 0, 0.125, 0.6875, 0.125, 1 }, { 0, 0.125, 0.6875, 0, 1 }, { 0, 0.125, 0.609135, 0, 1 }, { 0, 0.1875, 0.6875, 0, 1 }, { 0, 0.1875, 0.6875, -0.125, 1 }, { 0, 0.1875, 0.4375, 0.125, 1 }, { 0, 0.25, 0.6875, 0.125, 1 }, { 0, 0.25, 0.6875, 0, 1 }, { 0, 0.25, 0.609135, 0, 1 }, { 0, 0.3125, 0.6875, 0, 1 }, { 0, 0.3125, 0.6875, -0.125, 1 }, { 0, 0.3125, 0.432812, 0.125, 1 }, { 0, 0.375, 0.6875, 0.125, 1 }, { 0, 0.375, 0.6875, 0, 1 }, { 0, 0.375, 0.569952, 0, 1 }, { 0, 0.4375, 0.6875, 0, 1 }, { 0, 0.4375, 0.6875, -0.125, 1 }, { 0, 0.4375, 0.413221, 0.125, 1 }, { 0, 0.5, 0.6875, 0.125, 1 }, { 0, 0.5, 0.6875, 0, 1 }, { 0, 0.5, 0.569952, 0, 1 }, { 0, 0.5625, 0.6875, 0, 1 }, { 0, 0.5625, 0.6875, -0.125, 1 }, { 0, 0.5625, 0.432812, 0.125, 1 }, { 0, 0.625, 0.6875, 0.125, 1 }, { 0, 0.625, 0.6875, 0, 1 }, { 0, 0.625, 0.569952, 0, 1 }, { 0, 0.6875, 0.6875, 0, 1 }, { 0, 0.6875, 0.6875, -0.25, 1 }, { 0, 0.6875, 0.432812, 0.25, 1 }, { 0, 0.75, 0.6875, 0.25, 1 }, { 0, 0.75, 0.6875, 0, 1 }, { 0, 0.75, 0.550361, 0, 1 }, { 0, 0.8125, 0.6875, 0, 1 }, { 0, 0.8125, 0.6875, 0, 1 }, { 0, 0.8125, 0.432812, 0, 1 }, { 0, 0.875, 0.6875, 0, 1 }, { 0, 0.875, 0.4375, 0, 1 }, { 0, 0.9375, 0.6875, 0, 1 }, { 0, 0.9375, 0.6875, 0.344, 1 }, { 0, 1, 0.4375, 0, 1 }, { 0, 1, 0.6875, 0, 1 } };
+	inline constexpr PPoint cut5[] = { { 0, 0, 0.625, 0.052, 1 }, { 0, 0.125, 0.625, 0, 1 }, { 0, 0.125, 0.375, 0, 1 }, { 0, 0.25, 0.373125, 0, 1 }, { 0, 0.25, 0.621875, 0, 1 }, { 0, 0.375, 0.625, 0, 1 }, { 0, 0.375, 0.375, 0, 1 }, { 0, 0.5, 0.375, 0, 1 }, { 0, 0.5, 0.625, 0, 1 }, { 0, 0.625, 0.621875, 0, 1 }, { 0, 0.625, 0.373125, 0, 1 }, { 0, 0.75, 0.375, 0, 1 }, { 0, 0.75, 0.621875, 0, 1 }, { 0, 0.875, 0.621875, 0, 1 }, { 0, 0.875, 0.4975, 0, 1 }, { 0, 0.9375, 0.4975, 0, 1 }, { 0, 0.9375, 0.373125, 0, 1 }, { 0, 1, 0.373125, 0, 1 } };
+	inline constexpr PPoint cut6[] = { { 0, 1e-08, 0.496533, 0, 1 }, { 0, 0.0625, 0.496533, 0, 1 }, { 0, 0.0625, 0.3724, 0, 1 }, { 0, 0.125, 0.3724, 0, 1 }, { 0, 0.125, 0.186633, 0, 1 }, { 0, 0.25, 0.186633, 0, 1 }, { 0, 0.25, 0.310767, 0, 1 }, { 0, 0.3125, 0.310767, 0, 1 }, { 0, 0.3125, 0.434467, 0, 1 }, { 0, 0.375, 0.434467, 0, 1 }, { 0, 0.375, 0.434467, 0, 1 }, { 0, 0.4375, 0.434467, 0, 1 }, { 0, 0.4375, 0.682733, 0, 1 }, { 0, 0.5, 0.682733, 0, 1 }, { 0, 0.5, 0.249567, 0, 1 }, { 0, 0.625, 0.249567, 0, 1 }, { 0, 0.625, 0.311633, 0, 1 }, { 0, 0.6875, 0.311633, 0, 1 }, { 0, 0.6875, 0.496533, 0, 1 }, { 0, 0.75, 0.496533, 0, 1 }, { 0, 0.75, 0.310333, 0, 1 }, { 0, 0.8125, 0.310333, 0, 1 }, { 0, 0.8125, 0.248267, 0, 1 }, { 0, 0.9375, 0.248267, 0, 1 }, { 0, 0.9375, 0.620667, 0, 1 }, { 0, 1, 0.620667, 0, 1 } };
+	inline constexpr PPoint cut7[] = { { 0, 0, 0.25, -0.166, 6 }, { 0, 0.25, 0.5625, 0, 1 }, { 0, 0.25, 0.1875, 0.168, 6 }, { 0, 0.75, 0.75, -0.2, 3 }, { 0, 1, 0.25, 0, 1 } };
+	inline constexpr PPoint cut8[] = { { 0, 0, 0.5, 0, 1 }, { 0, 0.125, 0.5, 0, 1 }, { 0, 0.125, 0.375, 0.308, 1 }, { 0, 0.3125, 0.5, 0, 1 }, { 0, 0.375, 0.5, 0, 1 }, { 0, 0.375, 0.375, 0.386, 1 }, { 0, 0.625, 0.5, 0, 1 }, { 0, 0.75, 0.5, 0, 1 }, { 0, 0.75, 0.375, 0.252, 1 } };
+	inline constexpr PPoint cut9[] = { { 0, 1e-08, 0.625, 0, 1 }, { 0, 1.00062e-08, 0.0625, 0, 1 }, { 0, 0.0625, 0.625, 0, 1 }, { 0, 0.0625, 0.125, 0, 1 }, { 0, 0.1875, 0.6875, 0, 1 }, { 0, 0.1875, 0.0625, 0, 1 }, { 0, 0.25, 0.75, 0, 1 }, { 0, 0.25, 0.125, -0.116, 1 }, { 0, 0.4375, 0.75, 0, 1 }, { 0, 0.4375, 0.125, 0, 1 }, { 0, 0.5625, 0.6875, 0, 1 }, { 0, 0.5625, 0.6875, 0, 1 }, { 0, 0.5625, 0.0625, 0, 1 }, { 0, 0.625, 0.6875, 0, 1 }, { 0, 0.625, 0.125, 0, 1 }, { 0, 0.75, 0.625, 0, 1 }, { 0, 0.75, 0.0625, 0, 1 }, { 0, 0.8125, 0.5625, 0, 1 }, { 0, 0.8125, 0.125, 0, 1 }, { 0, 0.9375, 0.625, 0, 1 }, { 0, 0.9375, 0.625, 0, 1 }, { 0, 0.9375, 0.125, 0, 1 }, { 0, 1, 0.625, 0, 1 } };
+	inline constexpr PPoint cut10[] = { { 0, 2e-08, 0.75, 0, 1 }, { 0, 2.0025e-08, 0.503864, -0.236, 1 }, { 0, 0.25, 0.598391, 0, 1 }, { 0, 0.25, 0.655177, 0, 1 }, { 0, 0.25, 0.352319, -0.192, 1 }, { 0, 0.375, 0.579365, 0, 1 }, { 0, 0.375, 0.579365, 0, 1 }, { 0, 0.375, 0.276546, -0.172, 1 }, { 0, 0.625, 0.427742, 0, 1 }, { 0, 0.625, 0.427742, 0, 1 }, { 0, 0.625, 0.125, 0.024, 1 }, { 0, 0.75, 0.473726, 0, 1 }, { 0, 0.75, 0.473726, 0, 1 }, { 0, 0.75, 0.171023, 0, 1 }, { 0, 0.8125, 0.496718, 0, 1 }, { 0, 0.8125, 0.496718, 0, 1 }, { 0, 0.8125, 0.212952, 0, 1 }, { 0, 0.875, 0.51971, 0, 1 }, { 0, 0.875, 0.51971, 0, 1 }, { 0, 0.875, 0.311629, 0, 1 }, { 0, 0.9375, 0.542702, 0, 1 }, { 0, 0.9375, 0.542702, 0, 1 }, { 0, 0.9375, 0.410295, 0, 1 }, { 0, 1, 0.565694, 0, 1 } };
+	inline constexpr PPoint cut11[] = { { 0, 0, 0.09375, 0.00400001, 1 }, { 0, 0.1875, 0.9375, 0.416, 1 }, { 0, 0.1875, 0.4375, -0.088, 1 }, { 0, 0.375, 0.875, 0, 1 }, { 0, 0.375, 0.0625, 0.06, 1 }, { 0, 0.5, 0.875, 0, 1 }, { 0, 0.5, 0.4375, 0, 1 }, { 0, 0.6875, 0.875, 0, 1 }, { 0, 0.6875, 0.0625, 0, 1 }, { 0, 0.875, 0.875, 0, 1 }, { 0, 0.875, 0.375, 0, 1 }, { 0, 1, 0.875, 0, 1 } };
+	inline constexpr PPoint cut12[] = { { 0, 2e-08, 0.34375, 0, 1 }, { 0, 0.25, 0.34375, 0, 1 }, { 0, 0.25, 0.53125, 0, 1 }, { 0, 0.5, 0.53125, 0, 1 }, { 0, 0.5, 0.40625, 0, 1 }, { 0, 0.75, 0.40625, 0, 1 }, { 0, 0.75, 0.28125, 0, 1 }, { 0, 1, 0.28125, 0, 1 } };
 
-private:
-	static const std::vector<std::string>& getPaintPresets() {
-		static const std::vector<std::string> presets = {
-			"0 1 0 1 1 0 0 1", // line
-			"0.005 1 0 1 0.995 0 0 1", // Saw
-			"0 1 0 1 0.5 0 0 1 1 1 0 1", // triangle
-			"0.005 1 0 3 0.995 0 0 1", // square
-			"0 1 -0.302 1 0.5 0 -0.37 1 1 1 0 1", // Fin
-			"0.005 1 0.35 2 0.995 0 0 1", // S-Curve
-			"0.25 1 0.2 2 0.75 0 0.2 2", // sine
-			"0 1 0 1 0 0 -0.25 1 0.25 1 0 1 0.25 0.375 -0.25 1 0.5 1 0 1 0.5 0 -0.25 1 0.75 1 0 1 0.75 0.375 -0.25 1 1 1 0 1", // waves
-		};
-		return presets;
-	}
+	inline constexpr PPoint cut14[] = { { 0, 1e-08, 0.625, 0, 1 }, { 0, 2e-08, 0.1875, -0.168, 1 }, { 0, 0.125, 0.625, 0, 1 }, { 0, 0.125, 0.625, 0, 1 }, { 0, 0.125, 0.3125, 0, 1 }, { 0, 0.1875, 0.625, 0, 1 }, { 0, 0.1875, 0.625, 0, 1 }, { 0, 0.1875, 0.21875, 0, 1 }, { 0, 0.25, 0.625, 0, 1 }, { 0, 0.25, 0.625, 0, 1 }, { 0, 0.25, 0.3125, -0.088, 1 }, { 0, 0.375, 0.625, 0, 1 }, { 0, 0.375, 0.625, 0, 1 }, { 0, 0.375, 0.273438, 0, 1 }, { 0, 0.4375, 0.625, 0, 1 }, { 0, 0.4375, 0.625, 0, 1 }, { 0, 0.4375, 0.25, 0, 1 }, { 0, 0.5, 0.625, 0, 1 }, { 0, 0.5, 0.625, 0, 1 }, { 0, 0.5, 0.21875, -0.268, 1 }, { 0, 0.5625, 0.625, 0, 1 }, { 0, 0.5625, 0.25, 0, 1 }, { 0, 0.625, 0.625, 0, 1 }, { 0, 0.625, 0.625, 0, 1 }, { 0, 0.625, 0.273438, -0.04, 1 }, { 0, 0.6875, 0.625, 0, 1 }, { 0, 0.6875, 0.625, 0, 1 }, { 0, 0.6875, 0.21875, -0.162, 1 }, { 0, 0.875, 0.625, 0, 1 }, { 0, 0.875, 0.625, 0, 1 }, { 0, 0.875, 0.273438, 0, 1 }, { 0, 0.9375, 0.625, 0, 1 }, { 0, 0.9375, 0.625, 0, 1 }, { 0, 0.9375, 0.21875, 0, 1 }, { 0, 1, 0.625, 0, 1 } };
+	inline constexpr PPoint cut15[] = { { 0, 0, 0.884624, 0, 1 }, { 0, 1e-08, 0.387229, 0, 1 }, { 0, 0.125, 0.849293, 0, 1 }, { 0, 0.125, 0.849293, 0, 1 }, { 0, 0.125, 0.525113, 0, 1 }, { 0, 0.25, 0.813962, 0, 1 }, { 0, 0.25, 0.813962, 0, 1 }, { 0, 0.3125, 0.796296, 0, 1 }, { 0, 0.3125, 0.796296, 0, 1 }, { 0, 0.3125, 0.299699, 0, 1 }, { 0, 0.4375, 0.760965, 0, 1 }, { 0, 0.4375, 0.760965, 0, 1 }, { 0, 0.5, 0.7433, 0, 1 }, { 0, 0.5, 0.7433, 0.125, 1 }, { 0, 0.5, 0.20404, -0.125, 1 }, { 0, 0.625, 0.707969, -0.125, 1 }, { 0, 0.625, 0.707969, 0, 1 }, { 0, 0.6875, 0.690303, 0, 1 }, { 0, 0.6875, 0.690303, 0, 1 }, { 0, 0.6875, 0.194662, 0, 1 }, { 0, 0.75, 0.672638, 0, 1 }, { 0, 0.75, 0.672638, 0, 1 }, { 0, 0.75, 0.435668, 0, 1 }, { 0, 0.8125, 0.654972, 0, 1 }, { 0, 0.8125, 0.654972, 0, 1 }, { 0, 0.8125, 0.418079, 0, 1 }, { 0, 0.875, 0.637307, 0, 1 }, { 0, 0.875, 0.637307, 0, 1 }, { 0, 0.875, 0.142144, 0, 1 }, { 0, 1, 0.62349, 0, 1 } };
+	inline constexpr PPoint cut16[] = { { 0, 1e-08, 0.84375, 0, 1 }, { 0, 1.0025e-08, 0.3125, 0, 1 }, { 0, 0.25, 0.84375, 0, 1 }, { 0, 0.25, 0.84375, 0, 1 }, { 0, 0.25, 0.3125, 0, 1 }, { 0, 0.5, 0.84375, 0, 1 }, { 0, 0.5, 0.84375, 0.542, 1 }, { 0, 0.5, 0.3125, 0, 1 }, { 0, 0.625, 0.84375, 0.306, 1 }, { 0, 0.625, 0.3125, 0, 1 }, { 0, 0.75, 0.84375, 0, 1 }, { 0, 0.75, 0.84375, 0, 1 }, { 0, 0.75, 0.623858, 0, 1 }, { 0, 0.8125, 0.84375, 0, 1 }, { 0, 0.8125, 0.84375, 0, 1 }, { 0, 0.8125, 0.623858, 0, 1 }, { 0, 0.875, 0.84375, 0, 1 }, { 0, 0.875, 0.84375, 0, 1 }, { 0, 0.875, 0.374772, -0.016, 1 }, { 0, 1, 0.84375, 0, 1 } };
+	inline constexpr PPoint cut17[] = { { 0, 0, 0.743074, 0.16, 7 }, { 0, 0.5, 0.200676, 0.146, 7 } };
+	inline constexpr PPoint cut18[] = { { 0, 1e-08, 0.25, 0.016, 1 }, { 0, 0.0625, 0.596591, -0, 1 }, { 0, 0.0625, 0.25, -0, 1 }, { 0, 0.0625, 0.25, -0, 1 }, { 0, 0.125, 0.4375, -0, 1 }, { 0, 0.125, 0.25, -0, 1 }, { 0, 0.125, 0.25, -0, 1 }, { 0, 0.1875, 0.573864, -0, 1 }, { 0, 0.1875, 0.25, -0, 1 }, { 0, 0.1875, 0.25, -0, 1 }, { 0, 0.25, 0.25, -0, 1 }, { 0, 0.25, 0.25, -0, 1 }, { 0, 0.3125, 0.551136, -0, 1 }, { 0, 0.3125, 0.25, -0, 1 }, { 0, 0.3125, 0.25, -0, 1 }, { 0, 0.375, 0.4375, -0, 1 }, { 0, 0.375, 0.25, -0, 1 }, { 0, 0.4375, 0.25, -0, 1 }, { 0, 0.5, 0.573864, -0, 1 }, { 0, 0.5, 0.25, -0, 1 }, { 0, 0.625, 0.25, -0, 1 }, { 0, 0.6875, 0.528409, -0, 1 }, { 0, 0.6875, 0.25, -0, 1 }, { 0, 0.75, 0.25, -0, 1 }, { 0, 0.8125, 0.630682, -0, 1 }, { 0, 0.8125, 0.25, -0, 1 }, { 0, 0.8125, 0.25, 0, 1 }, { 0, 0.875, 0.5625, 0, 1 }, { 0, 0.875, 0.25, 0, 1 }, { 0, 0.875, 0.25, 0, 1 }, { 0, 0.9375, 0.75, 0, 1 }, { 0, 0.9375, 0.25, 0, 1 } };
+	inline constexpr PPoint cut19[] = { { 0, 0, 0.5, -0.214, 1 }, { 0, 0.125, 0.625, 0, 1 }, { 0, 0.125, 0.4375, 0, 1 }, { 0, 0.1875, 0.5625, 0, 1 }, { 0, 0.1875, 0.375, 0, 1 }, { 0, 0.25, 0.5, 0, 1 }, { 0, 0.25, 0.25, -0.084, 1 }, { 0, 0.375, 0.5625, 0, 1 }, { 0, 0.375, 0.40625, 0, 1 }, { 0, 0.4375, 0.5625, 0, 1 }, { 0, 0.4375, 0.4375, -0.156, 1 }, { 0, 0.625, 0.59375, 0, 1 }, { 0, 0.625, 0.4375, 0, 1 }, { 0, 0.75, 0.5625, 0, 1 }, { 0, 0.75, 0.34375, 0, 1 }, { 0, 0.8125, 0.5625, 0, 1 }, { 0, 0.8125, 0.4375, 0, 1 }, { 0, 0.875, 0.5625, 0, 1 }, { 0, 0.875, 0.375, 0, 1 }, { 0, 1, 0.5625, 0, 1 } };
+	inline constexpr PPoint cut20[] = { { 0, 1e-08, 0.34425, 0.264, 1 }, { 0, 0.25, 1, 0, 1 }, { 0, 0.25, 1, 0, 1 }, { 0, 0.25, 0.34425, 0, 1 }, { 0, 0.3125, 1, 0, 1 }, { 0, 0.3125, 1, 0, 1 }, { 0, 0.3125, 0.34425, 0, 1 }, { 0, 0.375, 1, 0, 1 }, { 0, 0.375, 1, 0, 1 }, { 0, 0.375, 0.34425, 0, 1 }, { 0, 0.5, 1, 0, 1 }, { 0, 0.5, 1, 0, 1 }, { 0, 0.5, 0.398896, 0, 1 }, { 0, 0.5625, 1, 0, 1 }, { 0, 0.5625, 1, 0, 1 }, { 0, 0.5625, 0.34425, 0, 1 }, { 0, 0.625, 1, 0, 1 }, { 0, 0.625, 1, 0, 1 }, { 0, 0.625, 0.34425, 0, 1 }, { 0, 0.75, 1, 0, 1 }, { 0, 0.75, 1, 0, 1 }, { 0, 0.75, 0.34425, 0, 1 }, { 0, 0.8125, 1, 0, 1 }, { 0, 0.8125, 1, 0, 1 }, { 0, 0.8125, 0.34425, 0, 1 }, { 0, 0.9375, 1, 0, 1 }, { 0, 0.9375, 1, 0, 1 }, { 0, 0.9375, 0.289604, 0, 1 }, { 0, 1, 1, 0, 1 } };
+	inline constexpr PPoint cut21[] = { { 0, 1e-08, 0.621617, 0, 1 }, { 0, 1.00125e-08, 0.186485, 0, 1 }, { 0, 0.125, 0.621617, 0, 1 }, { 0, 0.125, 0.621617, 0, 1 }, { 0, 0.125, 0.253429, 0, 1 }, { 0, 0.25, 0.621617, 0, 1 }, { 0, 0.25, 0.320372, 0, 1 }, { 0, 0.375, 0.320372, 0, 1 }, { 0, 0.375, 0.320372, 0, 1 }, { 0, 0.5, 0.621617, 0, 1 }, { 0, 0.5, 0.621617, 0, 1 }, { 0, 0.5, 0.219957, 0, 1 }, { 0, 0.5625, 0.621617, 0, 1 }, { 0, 0.5625, 0.621617, 0, 1 }, { 0, 0.5625, 0.219957, 0, 1 }, { 0, 0.625, 0.621617, 0, 1 }, { 0, 0.625, 0.320372, 0, 1 }, { 0, 0.75, 0.554674, 0, 1 }, { 0, 0.75, 0.219957, 0, 1 }, { 0, 0.8125, 0.621617, 0, 1 }, { 0, 0.8125, 0.621617, 0, 1 }, { 0, 0.8125, 0.219957, 0, 1 }, { 0, 0.875, 0.621617, 0, 1 }, { 0, 0.875, 0.353844, 0, 1 }, { 0, 1, 0.353844, 0, 1 } };
+	inline constexpr PPoint cut22[] = { { 0, 1e-08, 0.625, 0, 1 }, { 0, 1.00062e-08, 0.125, 0, 1 }, { 0, 0.0625, 0.625, 0, 1 }, { 0, 0.0625, 0.625, 0, 1 }, { 0, 0.0625, 0.125, 0, 1 }, { 0, 0.125, 0.625, 0, 1 }, { 0, 0.25, 0.625, 0, 1 }, { 0, 0.25, 0.1875, 0, 1 }, { 0, 0.3125, 0.625, 0, 1 }, { 0, 0.375, 0.625, 0, 1 }, { 0, 0.375, 0.5625, 0, 1 }, { 0, 0.4375, 0.625, 0, 1 }, { 0, 0.4375, 0.625, 0, 1 }, { 0, 0.4375, 0.375, 0, 1 }, { 0, 0.5, 0.625, 0.712, 1 }, { 0, 0.5625, 0.375, -0.262, 1 }, { 0, 0.75, 0.625, 0, 1 }, { 0, 0.75, 0.625, 0, 1 }, { 0, 0.75, 0.375, 0, 1 }, { 0, 0.8125, 0.625, 0, 1 }, { 0, 0.875, 0.625, 0, 1 }, { 0, 0.875, 0.375, 0, 1 }, { 0, 0.9375, 0.625, 0, 1 }, { 0, 0.9375, 0.625, 0, 1 }, { 0, 0.9375, 0.375, 0, 1 }, { 0, 1, 0.625, 0, 1 } };
+	inline constexpr PPoint cut23[] = { { 0, 1e-08, 1, 0, 1 }, { 0, 1.00062e-08, 0.25, 0, 1 }, { 0, 0.0625, 1, 0, 1 }, { 0, 0.0625, 1, 0, 1 }, { 0, 0.0625, 0.5, 0, 1 }, { 0, 0.125, 1, 0, 1 }, { 0, 0.125, 1, 0, 1 }, { 0, 0.125, 0.25, 0, 1 }, { 0, 0.1875, 1, 0, 1 }, { 0, 0.1875, 1, 0, 1 }, { 0, 0.1875, 0.5, 0, 1 }, { 0, 0.25, 1, 0, 1 }, { 0, 0.25, 1, 0, 1 }, { 0, 0.25, 0.25, 0, 1 }, { 0, 0.375, 1, 0, 1 }, { 0, 0.375, 1, 0, 1 }, { 0, 0.375, 0.25, 0, 1 }, { 0, 0.4375, 1, 0, 1 }, { 0, 0.4375, 1, 0, 1 }, { 0, 0.4375, 0.5, 0, 1 }, { 0, 0.5, 1, 0, 1 }, { 0, 0.5, 1, 0, 1 }, { 0, 0.5, 0.25, 0, 1 }, { 0, 0.5625, 1, 0, 1 }, { 0, 0.5625, 1, 0, 1 }, { 0, 0.5625, 0.5, 0, 1 }, { 0, 0.625, 1, 0, 1 }, { 0, 0.625, 1, 0, 1 }, { 0, 0.625, 0.25, 0, 1 }, { 0, 0.75, 1, 0, 1 }, { 0, 0.75, 1, 0, 1 }, { 0, 0.75, 0.333333, 0, 1 }, { 0, 0.8125, 1, 0, 1 }, { 0, 0.8125, 1, 0, 1 }, { 0, 0.8125, 0.5, 0, 1 }, { 0, 0.875, 1, 0, 1 }, { 0, 0.875, 1, 0, 1 }, { 0, 0.875, 0.25, 0, 1 }, { 0, 0.9375, 1, 0, 1 }, { 0, 0.9375, 1, 0, 1 }, { 0, 0.9375, 0.5, 0, 1 }, { 0, 1, 1, 0, 1 } };
+	inline constexpr PPoint cut24[] = { { 0, 1e-08, 0.771069, 0, 1 }, { 0, 1.00125e-08, 0.462642, 0, 1 }, { 0, 0.125, 0.771069, 0, 1 }, { 0, 0.125, 0.771069, 0, 1 }, { 0, 0.125, 0.231321, 0, 1 }, { 0, 0.1875, 0.771069, 0, 1 }, { 0, 0.1875, 0.771069, 0, 1 }, { 0, 0.1875, 0.404811, 0, 1 }, { 0, 0.3125, 0.771069, 0, 1 }, { 0, 0.3125, 0.771069, 0, 1 }, { 0, 0.3125, 0.231321, 0, 1 }, { 0, 0.375, 0.771069, 0, 1 }, { 0, 0.375, 0.771069, 0, 1 }, { 0, 0.375, 0.346981, 0, 1 }, { 0, 0.5, 0.771069, 0, 1 }, { 0, 0.5, 0.771069, 0, 1 }, { 0, 0.5, 0.231321, 0, 1 }, { 0, 0.5625, 0.771069, 0, 1 }, { 0, 0.5625, 0.771069, 0, 1 }, { 0, 0.5625, 0.404811, 0, 1 }, { 0, 0.6875, 0.771069, 0, 1 }, { 0, 0.6875, 0.771069, 0, 1 }, { 0, 0.6875, 0.231321, 0, 1 }, { 0, 0.75, 0.771069, 0, 1 }, { 0, 0.75, 0.771069, 0, 1 }, { 0, 0.75, 0.346981, 0, 1 }, { 0, 0.8125, 0.771069, 0, 1 }, { 0, 0.8125, 0.771069, 0, 1 }, { 0, 0.8125, 0.231321, 0, 1 }, { 0, 0.9375, 0.771069, 0, 1 }, { 0, 0.9375, 0.771069, 0, 1 }, { 0, 0.9375, 0.346981, 0, 1 }, { 0, 1, 0.771069, 0, 1 } };
+	inline constexpr PPoint cut25[] = { { 0, 0.0625, 0.128448, 0.2, 2 }, { 0, 0.1875, 0.8125, 0.2, 2 }, { 0, 0.265625, 0.128448, 0.2, 2 }, { 0, 0.296875, 0.8125, 0.2, 2 }, { 0, 0.328125, 0.128448, 0.2, 2 }, { 0, 0.359375, 0.8125, 0.2, 2 }, { 0, 0.390625, 0.128448, 0.2, 2 }, { 0, 0.421875, 0.8125, 0.2, 2 }, { 0, 0.453125, 0.128448, 0.2, 2 }, { 0, 0.484375, 0.8125, 0.2, 2 }, { 0, 0.515625, 0.128448, 0.2, 2 }, { 0, 0.546875, 0.8125, 0.2, 2 }, { 0, 0.609375, 0.8125, 0.2, 2 }, { 0, 0.640625, 0.128448, 0.2, 2 }, { 0, 0.671875, 0.8125, 0.2, 2 }, { 0, 0.703125, 0.128448, 0.2, 2 }, { 0, 0.734375, 0.8125, 0.2, 2 }, { 0, 0.765625, 0.128448, 0.2, 2 }, { 0, 0.796875, 0.8125, 0.2, 2 }, { 0, 0.828125, 0.128448, 0.2, 2 }, { 0, 0.859375, 0.8125, 0.2, 2 }, { 0, 0.90625, 0.128448, 0.2, 2 }, { 0, 0.96875, 0.8125, 0.2, 2 } };
 
-	static const std::vector<std::string>& getCutPresets() {
-		static const std::vector<std::string> presets = {
-			"", // HEAD 1-12 Basic
-			"0.25 0.75 0 1 0.75 0.25 0 1 ",
-			"1e-08 0.625 0 1 0.125 0.625 0 1 0.125 0.75 0 1 0.25 0.75 0 1 0.25 0.4375 0 1 0.375 0.4375 0 1 0.375 0.75 0 1 0.5 0.75 0 1 0.5 0.25 0.02 1 0.625 0.25 0 1 0.625 0.75 0 1 0.75 0.75 0 1 0.75 0.75 0 1 0.75 0.25 0 1 0.875 0.25 0 1 0.875 0.5 0 1 1 0.5 0 1 ",
-			"1e-08 0.75 0 1 0.0147541 0.307372 0 1 0.25 0.75 0 1 0.25 0.75 0 1 0.3125 0.75 0 1 0.3125 0.75 0 1 0.321311 0.44359 0 1 0.375 0.75 0 1 0.375 0.75 0 1 0.381967 0.435897 0 1 0.4375 0.75 0 1 0.5 0.75 0.125 1 0.514754 0.307372 -0.125 1 0.75 0.75 -0.125 1 0.8125 0.75 0 1 0.827254 0.369872 0 1 0.875 0.75 0 1 0.875 0.75 0 1 0.890164 0.5 0 1 0.9375 0.75 0 1 0.9375 0.75 0 1 0.94918 0.533333 0 1 1 0.75 0 1 ",
-			"1e-08 0.6875 0 1 2e-08 0.625 0 1 0.0625 0.6875 0 1 0.0625 0.6875 -0.125 1 0.0625 0.374038 0.125 1 0.125 0.6875 0.125 1 0.125 0.6875 0 1 0.125 0.609135 0 1 0.1875 0.6875 0 1 0.1875 0.6875 -0.125 1 0.1875 0.4375 0.125 1 0.25 0.6875 0.125 1 0.25 0.6875 0 1 0.25 0.609135 0 1 0.3125 0.6875 0 1 0.3125 0.6875 -0.125 1 0.3125 0.432812 0.125 1 0.375 0.6875 0.125 1 0.375 0.6875 0 1 0.375 0.569952 0 1 0.4375 0.6875 0 1 0.4375 0.6875 -0.125 1 0.4375 0.413221 0.125 1 0.5 0.6875 0.125 1 0.5 0.6875 0 1 0.5 0.569952 0 1 0.5625 0.6875 0 1 0.5625 0.6875 -0.125 1 0.5625 0.432812 0.125 1 0.625 0.6875 0.125 1 0.625 0.6875 0 1 0.625 0.569952 0 1 0.6875 0.6875 0 1 0.6875 0.6875 -0.25 1 0.6875 0.432812 0.25 1 0.75 0.6875 0.25 1 0.75 0.6875 0 1 0.75 0.550361 0 1 0.8125 0.6875 0 1 0.8125 0.6875 0 1 0.8125 0.432812 0 1 0.875 0.6875 0 1 0.875 0.4375 0 1 0.9375 0.6875 0 1 0.9375 0.6875 0.344 1 1 0.4375 0 1 1 0.6875 0 1 ",
-			"0 0.625 0.052 1 0.125 0.625 0 1 0.125 0.375 0 1 0.25 0.373125 0 1 0.25 0.621875 0 1 0.375 0.625 0 1 0.375 0.375 0 1 0.5 0.375 0 1 0.5 0.625 0 1 0.625 0.621875 0 1 0.625 0.373125 0 1 0.75 0.375 0 1 0.75 0.621875 0 1 0.875 0.621875 0 1 0.875 0.4975 0 1 0.9375 0.4975 0 1 0.9375 0.373125 0 1 1 0.373125 0 1 ",
-			"1e-08 0.496533 0 1 0.0625 0.496533 0 1 0.0625 0.3724 0 1 0.125 0.3724 0 1 0.125 0.186633 0 1 0.25 0.186633 0 1 0.25 0.310767 0 1 0.3125 0.310767 0 1 0.3125 0.434467 0 1 0.375 0.434467 0 1 0.375 0.434467 0 1 0.4375 0.434467 0 1 0.4375 0.682733 0 1 0.5 0.682733 0 1 0.5 0.249567 0 1 0.625 0.249567 0 1 0.625 0.311633 0 1 0.6875 0.311633 0 1 0.6875 0.496533 0 1 0.75 0.496533 0 1 0.75 0.310333 0 1 0.8125 0.310333 0 1 0.8125 0.248267 0 1 0.9375 0.248267 0 1 0.9375 0.620667 0 1 1 0.620667 0 1 ",
-			"0 0.25 -0.166 6 0.25 0.5625 0 1 0.25 0.1875 0.168 6 0.75 0.75 -0.2 3 1 0.25 0 1 ",
-			"0 0.5 0 1 0.125 0.5 0 1 0.125 0.375 0.308 1 0.3125 0.5 0 1 0.375 0.5 0 1 0.375 0.375 0.386 1 0.625 0.5 0 1 0.75 0.5 0 1 0.75 0.375 0.252 1 ",
-			"1e-08 0.625 0 1 1.00062e-08 0.0625 0 1 0.0625 0.625 0 1 0.0625 0.125 0 1 0.1875 0.6875 0 1 0.1875 0.0625 0 1 0.25 0.75 0 1 0.25 0.125 -0.116 1 0.4375 0.75 0 1 0.4375 0.125 0 1 0.5625 0.6875 0 1 0.5625 0.6875 0 1 0.5625 0.0625 0 1 0.625 0.6875 0 1 0.625 0.125 0 1 0.75 0.625 0 1 0.75 0.0625 0 1 0.8125 0.5625 0 1 0.8125 0.125 0 1 0.9375 0.625 0 1 0.9375 0.625 0 1 0.9375 0.125 0 1 1 0.625 0 1 ",
-			"2e-08 0.75 0 1 2.0025e-08 0.503864 -0.236 1 0.25 0.598391 0 1 0.25 0.655177 0 1 0.25 0.352319 -0.192 1 0.375 0.579365 0 1 0.375 0.579365 0 1 0.375 0.276546 -0.172 1 0.625 0.427742 0 1 0.625 0.427742 0 1 0.625 0.125 0.024 1 0.75 0.473726 0 1 0.75 0.473726 0 1 0.75 0.171023 0 1 0.8125 0.496718 0 1 0.8125 0.496718 0 1 0.8125 0.212952 0 1 0.875 0.51971 0 1 0.875 0.51971 0 1 0.875 0.311629 0 1 0.9375 0.542702 0 1 0.9375 0.542702 0 1 0.9375 0.410295 0 1 1 0.565694 0 1 ",
-			"0 0.09375 0.00400001 1 0.1875 0.9375 0.416 1 0.1875 0.4375 -0.088 1 0.375 0.875 0 1 0.375 0.0625 0.06 1 0.5 0.875 0 1 0.5 0.4375 0 1 0.6875 0.875 0 1 0.6875 0.0625 0 1 0.875 0.875 0 1 0.875 0.375 0 1 1 0.875 0 1 ",
-			"2e-08 0.34375 0 1 0.25 0.34375 0 1 0.25 0.53125 0 1 0.5 0.53125 0 1 0.5 0.40625 0 1 0.75 0.40625 0 1 0.75 0.28125 0 1 1 0.28125 0 1 ",
-
-			"", // HEAD 1-12 Gated
-			"1e-08 0.625 0 1 2e-08 0.1875 -0.168 1 0.125 0.625 0 1 0.125 0.625 0 1 0.125 0.3125 0 1 0.1875 0.625 0 1 0.1875 0.625 0 1 0.1875 0.21875 0 1 0.25 0.625 0 1 0.25 0.625 0 1 0.25 0.3125 -0.088 1 0.375 0.625 0 1 0.375 0.625 0 1 0.375 0.273438 0 1 0.4375 0.625 0 1 0.4375 0.625 0 1 0.4375 0.25 0 1 0.5 0.625 0 1 0.5 0.625 0 1 0.5 0.21875 -0.268 1 0.5625 0.625 0 1 0.5625 0.25 0 1 0.625 0.625 0 1 0.625 0.625 0 1 0.625 0.273438 -0.04 1 0.6875 0.625 0 1 0.6875 0.625 0 1 0.6875 0.21875 -0.162 1 0.875 0.625 0 1 0.875 0.625 0 1 0.875 0.273438 0 1 0.9375 0.625 0 1 0.9375 0.625 0 1 0.9375 0.21875 0 1 1 0.625 0 1 ",
-			"0 0.884624 0 1 1e-08 0.387229 0 1 0.125 0.849293 0 1 0.125 0.849293 0 1 0.125 0.525113 0 1 0.25 0.813962 0 1 0.25 0.813962 0 1 0.3125 0.796296 0 1 0.3125 0.796296 0 1 0.3125 0.299699 0 1 0.4375 0.760965 0 1 0.4375 0.760965 0 1 0.5 0.7433 0 1 0.5 0.7433 0.125 1 0.5 0.20404 -0.125 1 0.625 0.707969 -0.125 1 0.625 0.707969 0 1 0.6875 0.690303 0 1 0.6875 0.690303 0 1 0.6875 0.194662 0 1 0.75 0.672638 0 1 0.75 0.672638 0 1 0.75 0.435668 0 1 0.8125 0.654972 0 1 0.8125 0.654972 0 1 0.8125 0.418079 0 1 0.875 0.637307 0 1 0.875 0.637307 0 1 0.875 0.142144 0 1 1 0.62349 0 1 ",
-			"1e-08 0.84375 0 1 1.0025e-08 0.3125 0 1 0.25 0.84375 0 1 0.25 0.84375 0 1 0.25 0.3125 0 1 0.5 0.84375 0 1 0.5 0.84375 0.542 1 0.5 0.3125 0 1 0.625 0.84375 0.306 1 0.625 0.3125 0 1 0.75 0.84375 0 1 0.75 0.84375 0 1 0.75 0.623858 0 1 0.8125 0.84375 0 1 0.8125 0.84375 0 1 0.8125 0.623858 0 1 0.875 0.84375 0 1 0.875 0.84375 0 1 0.875 0.374772 -0.016 1 1 0.84375 0 1 ",
-			"0 0.743074 0.16 7 0.5 0.200676 0.146 7",
-			"1e-08 0.25 0.016 1 0.0625 0.596591 -0 1 0.0625 0.25 -0 1 0.0625 0.25 -0 1 0.125 0.4375 -0 1 0.125 0.25 -0 1 0.125 0.25 -0 1 0.1875 0.573864 -0 1 0.1875 0.25 -0 1 0.1875 0.25 -0 1 0.25 0.25 -0 1 0.25 0.25 -0 1 0.3125 0.551136 -0 1 0.3125 0.25 -0 1 0.3125 0.25 -0 1 0.375 0.4375 -0 1 0.375 0.25 -0 1 0.4375 0.25 -0 1 0.5 0.573864 -0 1 0.5 0.25 -0 1 0.625 0.25 -0 1 0.6875 0.528409 -0 1 0.6875 0.25 -0 1 0.75 0.25 -0 1 0.8125 0.630682 -0 1 0.8125 0.25 -0 1 0.8125 0.25 0 1 0.875 0.5625 0 1 0.875 0.25 0 1 0.875 0.25 0 1 0.9375 0.75 0 1 0.9375 0.25 0 1 ",
-			"0 0.5 -0.214 1 0.125 0.625 0 1 0.125 0.4375 0 1 0.1875 0.5625 0 1 0.1875 0.375 0 1 0.25 0.5 0 1 0.25 0.25 -0.084 1 0.375 0.5625 0 1 0.375 0.40625 0 1 0.4375 0.5625 0 1 0.4375 0.4375 -0.156 1 0.625 0.59375 0 1 0.625 0.4375 0 1 0.75 0.5625 0 1 0.75 0.34375 0 1 0.8125 0.5625 0 1 0.8125 0.4375 0 1 0.875 0.5625 0 1 0.875 0.375 0 1 1 0.5625 0 1 ",
-			"1e-08 0.34425 0.264 1 0.25 1 0 1 0.25 1 0 1 0.25 0.34425 0 1 0.3125 1 0 1 0.3125 1 0 1 0.3125 0.34425 0 1 0.375 1 0 1 0.375 1 0 1 0.375 0.34425 0 1 0.5 1 0 1 0.5 1 0 1 0.5 0.398896 0 1 0.5625 1 0 1 0.5625 1 0 1 0.5625 0.34425 0 1 0.625 1 0 1 0.625 1 0 1 0.625 0.34425 0 1 0.75 1 0 1 0.75 1 0 1 0.75 0.34425 0 1 0.8125 1 0 1 0.8125 1 0 1 0.8125 0.34425 0 1 0.9375 1 0 1 0.9375 1 0 1 0.9375 0.289604 0 1 1 1 0 1 ",
-			"1e-08 0.621617 0 1 1.00125e-08 0.186485 0 1 0.125 0.621617 0 1 0.125 0.621617 0 1 0.125 0.253429 0 1 0.25 0.621617 0 1 0.25 0.320372 0 1 0.375 0.320372 0 1 0.375 0.320372 0 1 0.5 0.621617 0 1 0.5 0.621617 0 1 0.5 0.219957 0 1 0.5625 0.621617 0 1 0.5625 0.621617 0 1 0.5625 0.219957 0 1 0.625 0.621617 0 1 0.625 0.320372 0 1 0.75 0.554674 0 1 0.75 0.219957 0 1 0.8125 0.621617 0 1 0.8125 0.621617 0 1 0.8125 0.219957 0 1 0.875 0.621617 0 1 0.875 0.353844 0 1 1 0.353844 0 1 ",
-			"1e-08 0.625 0 1 1.00062e-08 0.125 0 1 0.0625 0.625 0 1 0.0625 0.625 0 1 0.0625 0.125 0 1 0.125 0.625 0 1 0.25 0.625 0 1 0.25 0.1875 0 1 0.3125 0.625 0 1 0.375 0.625 0 1 0.375 0.5625 0 1 0.4375 0.625 0 1 0.4375 0.625 0 1 0.4375 0.375 0 1 0.5 0.625 0.712 1 0.5625 0.375 -0.262 1 0.75 0.625 0 1 0.75 0.625 0 1 0.75 0.375 0 1 0.8125 0.625 0 1 0.875 0.625 0 1 0.875 0.375 0 1 0.9375 0.625 0 1 0.9375 0.625 0 1 0.9375 0.375 0 1 1 0.625 0 1 ",
-			"1e-08 1 0 1 1.00062e-08 0.25 0 1 0.0625 1 0 1 0.0625 1 0 1 0.0625 0.5 0 1 0.125 1 0 1 0.125 1 0 1 0.125 0.25 0 1 0.1875 1 0 1 0.1875 1 0 1 0.1875 0.5 0 1 0.25 1 0 1 0.25 1 0 1 0.25 0.25 0 1 0.375 1 0 1 0.375 1 0 1 0.375 0.25 0 1 0.4375 1 0 1 0.4375 1 0 1 0.4375 0.5 0 1 0.5 1 0 1 0.5 1 0 1 0.5 0.25 0 1 0.5625 1 0 1 0.5625 1 0 1 0.5625 0.5 0 1 0.625 1 0 1 0.625 1 0 1 0.625 0.25 0 1 0.75 1 0 1 0.75 1 0 1 0.75 0.333333 0 1 0.8125 1 0 1 0.8125 1 0 1 0.8125 0.5 0 1 0.875 1 0 1 0.875 1 0 1 0.875 0.25 0 1 0.9375 1 0 1 0.9375 1 0 1 0.9375 0.5 0 1 1 1 0 1 ",
-			"1e-08 0.771069 0 1 1.00125e-08 0.462642 0 1 0.125 0.771069 0 1 0.125 0.771069 0 1 0.125 0.231321 0 1 0.1875 0.771069 0 1 0.1875 0.771069 0 1 0.1875 0.404811 0 1 0.3125 0.771069 0 1 0.3125 0.771069 0 1 0.3125 0.231321 0 1 0.375 0.771069 0 1 0.375 0.771069 0 1 0.375 0.346981 0 1 0.5 0.771069 0 1 0.5 0.771069 0 1 0.5 0.231321 0 1 0.5625 0.771069 0 1 0.5625 0.771069 0 1 0.5625 0.404811 0 1 0.6875 0.771069 0 1 0.6875 0.771069 0 1 0.6875 0.231321 0 1 0.75 0.771069 0 1 0.75 0.771069 0 1 0.75 0.346981 0 1 0.8125 0.771069 0 1 0.8125 0.771069 0 1 0.8125 0.231321 0 1 0.9375 0.771069 0 1 0.9375 0.771069 0 1 0.9375 0.346981 0 1 1 0.771069 0 1 ",
-			"0.0625 0.128448 0.2 2 0.1875 0.8125 0.2 2 0.265625 0.128448 0.2 2 0.296875 0.8125 0.2 2 0.328125 0.128448 0.2 2 0.359375 0.8125 0.2 2 0.390625 0.128448 0.2 2 0.421875 0.8125 0.2 2 0.453125 0.128448 0.2 2 0.484375 0.8125 0.2 2 0.515625 0.128448 0.2 2 0.546875 0.8125 0.2 2 0.609375 0.8125 0.2 2 0.640625 0.128448 0.2 2 0.671875 0.8125 0.2 2 0.703125 0.128448 0.2 2 0.734375 0.8125 0.2 2 0.765625 0.128448 0.2 2 0.796875 0.8125 0.2 2 0.828125 0.128448 0.2 2 0.859375 0.8125 0.2 2 0.90625 0.128448 0.2 2 0.96875 0.8125 0.2 2 ",
-
-			"", // Other / FX (1-6 Waves, 7-12 FX)
-			"0.078125 0.1875 0.2 2 0.203125 0.939782 0.2 2 0.328125 0.194842 0.2 2 0.453125 0.819346 0.2 2 0.539063 0.156659 0.2 2 0.601562 0.747838 0.2 2 0.664063 0.165244 0.2 2 0.726562 0.68762 0.2 2 0.769531 0.172488 0.2 2 0.800781 0.651865 0.2 2 0.832031 0.17678 0.2 2 0.863281 0.621756 0.2 2 0.894531 0.179722 0.2 2 0.925781 0.591647 0.2 2 0.957031 0.185366 0.2 2 0.988281 0.561538 0.2 2 ",
-			"0.0625 0.128448 0.2 2 0.1875 0.8125 0.2 2 0.265625 0.128448 0.2 2 0.296875 0.8125 0.2 2 0.328125 0.128448 0.2 2 0.359375 0.8125 0.2 2 0.390625 0.128448 0.2 2 0.421875 0.8125 0.2 2 0.453125 0.128448 0.2 2 0.484375 0.8125 0.2 2 0.515625 0.128448 0.2 2 0.546875 0.8125 0.2 2 0.609375 0.8125 0.2 2 0.640625 0.128448 0.2 2 0.671875 0.8125 0.2 2 0.703125 0.128448 0.2 2 0.734375 0.8125 0.2 2 0.765625 0.128448 0.2 2 0.796875 0.8125 0.2 2 0.828125 0.128448 0.2 2 0.859375 0.8125 0.2 2 0.90625 0.128448 0.2 2 0.96875 0.8125 0.2 2 ",
-			"0.020543 0.0025641 0.2 2 0.051793 0.692308 0.2 2 0.083043 0.127564 0.2 2 0.114293 0.692308 0.2 2 0.145543 0.315064 0.2 2 0.176793 0.692308 0.2 2 0.208043 0.692308 0.2 2 0.239293 0.692308 0.2 2 0.270543 0.377564 0.2 2 0.301793 0.692308 0.2 2 0.333043 0.190064 0.2 2 0.364293 0.692308 0.2 2 0.395543 0.127564 0.2 2 0.426793 0.692308 0.2 2 0.958043 0.0025641 0.2 2 0.989293 0.692308 0.2 2 ",
-			"0 0 0.256 1 0.71875 1 0.2 2 0.770833 0.375 0.2 2 0.84375 0.6875 0.2 2 0.854167 0.25 0.2 2 0.921875 0.6875 0.2 2 0.9375 0.333333 0.2 2 1 0.6875 0.2 2 ",
-			"0.015625 0.176282 0.2 2 0.046875 0.753423 0.2 2 0.078125 0.172179 0.2 2 0.109375 0.758346 0.2 2 0.140625 0.168077 0.2 2 0.171875 0.763269 0.2 2 0.203125 0.163974 0.2 2 0.234375 0.768192 0.2 2 0.265625 0.104346 0.2 2 0.296875 0.773115 0.2 2 0.328125 0.0994231 0.2 2 0.359375 0.778038 0.2 2 0.390625 0.0945 0.2 2 0.421875 0.782962 0.2 2 0.453125 0.0895769 0.2 2 0.484375 0.787885 0.2 2 0.515625 0.0846538 0.2 2 0.546875 0.792808 0.2 2 0.578125 0.0797308 0.2 2 0.609375 0.797731 0.2 2 0.640625 0.135256 0.2 2 0.671875 0.802654 0.2 2 0.703125 0.131154 0.2 2 0.734375 0.807577 0.2 2 0.765625 0.0649615 0.2 2 0.796875 0.8125 -0.306 1 ",
-			"0.0772541 0.169872 0.2 2 0.194057 0.675023 0.2 2 0.280379 0.201939 0.2 2 0.303432 0.644731 0.2 2 0.342879 0.162735 0.2 2 0.365932 0.627422 0.2 2 0.405379 0.221672 0.2 2 0.428432 0.610112 0.2 2 0.499129 0.236472 0.2 2 0.584682 0.566838 0.2 2 0.631557 0.278063 0.2 2 0.678432 0.540874 0.2 2 0.717879 0.301115 0.2 2 0.740932 0.523565 0.2 2 0.780379 0.307822 0.2 2 0.803432 0.506255 0.2 2 0.842879 0.314529 0.2 2 0.865932 0.488946 0.2 2 0.921004 0.322912 0.2 2 0.975307 0.458654 0.2 2 ",
-			"1e-08 0.298903 -0 1 0.0625 0.246379 -0 1 0.0625 0.341817 -0 1 0.0625 0.341817 -0 1 0.125 0.246379 -0 1 0.125 0.38473 -0 1 0.125 0.38473 -0 1 0.1875 0.246379 -0 1 0.1875 0.427643 -0 1 0.1875 0.427643 -0 1 0.25 0.246379 -0 1 0.25 0.470556 -0 1 0.25 0.470556 -0 1 0.3125 0.246379 -0 1 0.3125 0.513469 -0 1 0.3125 0.513469 -0 1 0.375 0.246379 -0 1 0.375 0.556383 -0 1 0.375 0.556383 -0 1 0.4375 0.246379 -0 1 0.4375 0.599296 -0 1 0.4375 0.599296 -0 1 0.5 0.246379 -0 1 0.5 0.642209 -0 1 0.5 0.642209 -0 1 0.5625 0.246379 -0 1 0.5625 0.685122 -0 1 0.5625 0.685122 -0 1 0.625 0.246379 -0 1 0.625 0.728035 -0 1 0.625 0.728035 -0 1 0.6875 0.246379 -0 1 0.6875 0.770949 -0 1 0.6875 0.770949 -0 1 0.75 0.246379 -0 1 0.75 0.813862 -0 1 0.75 0.813862 -0 1 0.8125 0.246379 -0 1 0.8125 0.856775 -0 1 0.8125 0.856775 -0 1 0.875 0.246379 -0 1 0.875 0.899688 -0 1 0.875 0.899688 -0 1 0.9375 0.246379 -0 1 0.9375 0.942602 -0 1 0.9375 0.942602 -0 1 1 0.246379 -0 1 1 0.985515 -0 1 ",
-			"1e-08 0.435897 0 1 0.03125 0.36266 0 1 0.0625 0.471154 0 1 0.0625 0.471154 0 1 0.09375 0.339263 0 1 0.125 0.50641 0 1 0.125 0.50641 0 1 0.15625 0.315865 0 1 0.1875 0.541667 0 1 0.1875 0.541667 0 1 0.21875 0.292468 0 1 0.25 0.576923 0 1 0.25 0.576923 0 1 0.28125 0.269071 0 1 0.3125 0.612179 0 1 0.3125 0.612179 0 1 0.34375 0.245673 0 1 0.375 0.647436 0 1 0.375 0.647436 0 1 0.40625 0.222276 0 1 0.4375 0.682692 0 1 0.4375 0.682692 0 1 0.46875 0.198878 0 1 0.5 0.717949 0 1 0.5 0.717949 0 1 0.53125 0.175481 0 1 0.5625 0.753205 0 1 0.5625 0.753205 0 1 0.59375 0.152083 0 1 0.625 0.788462 0 1 0.625 0.788462 0 1 0.65625 0.128686 0 1 0.6875 0.823718 0 1 0.6875 0.823718 0 1 0.71875 0.105288 0 1 0.75 0.858974 0 1 0.75 0.858974 0 1 0.78125 0.081891 0 1 0.8125 0.894231 0 1 0.8125 0.894231 0 1 0.84375 0.0584936 0 1 0.875 0.929487 0 1 0.875 0.929487 0 1 0.90625 0.0350962 0 1 0.9375 0.964744 0 1 0.9375 0.964744 0 1 0.96875 0.0116987 0 1 1 1 0 1 ",
-			"0 0.125 0 1 1 0.75 0 1 ",
-			"1e-08 0.75 -0 1 0.015625 0.25 -0 1 0.015625 0.75 -0 1 0.015625 0.75 -0 1 0.03125 0.25 -0 1 0.03125 0.75 -0 1 0.03125 0.75 -0 1 0.046875 0.25 -0 1 0.046875 0.75 -0 1 0.046875 0.75 -0 1 0.0625 0.25 -0 1 0.0625 0.75 -0 1 0.0625 0.75 -0 1 0.078125 0.25 -0 1 0.078125 0.75 -0 1 0.078125 0.75 -0 1 0.09375 0.25 -0 1 0.09375 0.75 -0 1 0.09375 0.75 -0 1 0.109375 0.25 -0 1 0.109375 0.75 -0 1 0.109375 0.75 -0 1 0.125 0.25 -0 1 0.125 0.75 -0 1 0.125 0.75 -0 1 0.140625 0.25 -0 1 0.140625 0.75 -0 1 0.140625 0.75 -0 1 0.15625 0.25 -0 1 0.15625 0.75 -0 1 0.15625 0.75 -0 1 0.171875 0.25 -0 1 0.171875 0.75 -0 1 0.171875 0.75 -0 1 0.1875 0.25 -0 1 0.1875 0.75 -0 1 0.1875 0.75 -0 1 0.203125 0.25 -0 1 0.203125 0.75 -0 1 0.203125 0.75 -0 1 0.21875 0.25 -0 1 0.21875 0.75 -0 1 0.21875 0.75 -0 1 0.234375 0.25 -0 1 0.234375 0.75 -0 1 0.234375 0.75 -0 1 0.25 0.25 -0 1 0.25 0.75 -0 1 0.25 0.75 -0 1 0.28125 0.3125 -0 1 0.28125 0.75 -0 1 0.28125 0.75 -0 1 0.3125 0.3125 -0 1 0.3125 0.75 -0 1 0.3125 0.75 -0 1 0.34375 0.25 -0 1 0.34375 0.75 -0 1 0.34375 0.75 -0 1 0.375 0.25 -0 1 0.375 0.75 -0 1 0.375 0.75 -0 1 0.40625 0.25 -0 1 0.40625 0.75 -0 1 0.40625 0.75 -0 1 0.4375 0.25 -0 1 0.4375 0.75 -0 1 0.4375 0.75 -0 1 0.46875 0.25 -0 1 0.46875 0.75 -0 1 0.46875 0.75 -0 1 0.5 0.25 -0 1 0.5 0.75 -0 1 0.5 0.75 -0 1 0.5625 0.1875 -0 1 0.5625 0.75 -0 1 0.5625 0.75 -0 1 0.625 0.1875 -0 1 0.625 0.75 -0 1 0.625 0.75 -0 1 0.6875 0.1875 -0 1 0.6875 0.75 -0 1 0.6875 0.75 -0 1 0.75 0.1875 -0 1 0.75 0.75 -0 1 0.75 0.75 -0 1 0.875 0.1875 -0 1 0.875 0.75 -0 1 0.875 0.75 -0 1 1 0.1875 -0 1 1 0.75 -0 1 ",
-			"0 0.321875 0.276 1 0.0625 0.64375 0.324 1 0.125 0.321875 0 1 0.125 0.321875 0.276 1 0.1875 0.64375 0.228 1 0.25 0.321875 0 1 0.25 0.321875 0.276 1 0.3125 0.64375 0.228 1 0.375 0.321875 0 1 0.375 0.321875 0.276 1 0.4375 0.64375 0.228 1 0.5 0.321875 0 1 0.5 0.321875 0.276 1 0.5625 0.64375 0.324 1 0.625 0.321875 0 1 0.625 0.321875 0.276 1 0.6875 0.64375 0.228 1 0.75 0.321875 0 1 0.75 0.321875 0.276 1 0.8125 0.64375 0.228 1 0.875 0.321875 0 1 0.875 0.321875 0.276 1 0.9375 0.64375 0.228 1 1 0.321875 0 1 ",
-			"0 0.5 0 1 0.125 0.5 0 1 0.125 0.375 0.308 1 0.3125 0.5 0 1 0.375 0.5 0 1 0.375 0.375 0.386 1 0.625 0.5 0 1 0.75 0.5 0 1 0.75 0.375 0.252 1 ",
-		};
-		return presets;
-	}
+	inline constexpr PPoint cut27[] = { { 0, 0.078125, 0.1875, 0.2, 2 }, { 0, 0.203125, 0.939782, 0.2, 2 }, { 0, 0.328125, 0.194842, 0.2, 2 }, { 0, 0.453125, 0.819346, 0.2, 2 }, { 0, 0.539063, 0.156659, 0.2, 2 }, { 0, 0.601562, 0.747838, 0.2, 2 }, { 0, 0.664063, 0.165244, 0.2, 2 }, { 0, 0.726562, 0.68762, 0.2, 2 }, { 0, 0.769531, 0.172488, 0.2, 2 }, { 0, 0.800781, 0.651865, 0.2, 2 }, { 0, 0.832031, 0.17678, 0.2, 2 }, { 0, 0.863281, 0.621756, 0.2, 2 }, { 0, 0.894531, 0.179722, 0.2, 2 }, { 0, 0.925781, 0.591647, 0.2, 2 }, { 0, 0.957031, 0.185366, 0.2, 2 }, { 0, 0.988281, 0.561538, 0.2, 2 } };
+	inline constexpr PPoint cut28[] = { { 0, 0.0625, 0.128448, 0.2, 2 }, { 0, 0.1875, 0.8125, 0.2, 2 }, { 0, 0.265625, 0.128448, 0.2, 2 }, { 0, 0.296875, 0.8125, 0.2, 2 }, { 0, 0.328125, 0.128448, 0.2, 2 }, { 0, 0.359375, 0.8125, 0.2, 2 }, { 0, 0.390625, 0.128448, 0.2, 2 }, { 0, 0.421875, 0.8125, 0.2, 2 }, { 0, 0.453125, 0.128448, 0.2, 2 }, { 0, 0.484375, 0.8125, 0.2, 2 }, { 0, 0.515625, 0.128448, 0.2, 2 }, { 0, 0.546875, 0.8125, 0.2, 2 }, { 0, 0.609375, 0.8125, 0.2, 2 }, { 0, 0.640625, 0.128448, 0.2, 2 }, { 0, 0.671875, 0.8125, 0.2, 2 }, { 0, 0.703125, 0.128448, 0.2, 2 }, { 0, 0.734375, 0.8125, 0.2, 2 }, { 0, 0.765625, 0.128448, 0.2, 2 }, { 0, 0.796875, 0.8125, 0.2, 2 }, { 0, 0.828125, 0.128448, 0.2, 2 }, { 0, 0.859375, 0.8125, 0.2, 2 }, { 0, 0.90625, 0.128448, 0.2, 2 }, { 0, 0.96875, 0.8125, 0.2, 2 } };
+	inline constexpr PPoint cut29[] = { { 0, 0.020543, 0.0025641, 0.2, 2 }, { 0, 0.051793, 0.692308, 0.2, 2 }, { 0, 0.083043, 0.127564, 0.2, 2 }, { 0, 0.114293, 0.692308, 0.2, 2 }, { 0, 0.145543, 0.315064, 0.2, 2 }, { 0, 0.176793, 0.692308, 0.2, 2 }, { 0, 0.208043, 0.692308, 0.2, 2 }, { 0, 0.239293, 0.692308, 0.2, 2 }, { 0, 0.270543, 0.377564, 0.2, 2 }, { 0, 0.301793, 0.692308, 0.2, 2 }, { 0, 0.333043, 0.190064, 0.2, 2 }, { 0, 0.364293, 0.692308, 0.2, 2 }, { 0, 0.395543, 0.127564, 0.2, 2 }, { 0, 0.426793, 0.692308, 0.2, 2 }, { 0, 0.958043, 0.0025641, 0.2, 2 }, { 0, 0.989293, 0.692308, 0.2, 2 } };
+	inline constexpr PPoint cut30[] = { { 0, 0, 0, 0.256, 1 }, { 0, 0.71875, 1, 0.2, 2 }, { 0, 0.770833, 0.375, 0.2, 2 }, { 0, 0.84375, 0.6875, 0.2, 2 }, { 0, 0.854167, 0.25, 0.2, 2 }, { 0, 0.921875, 0.6875, 0.2, 2 }, { 0, 0.9375, 0.333333, 0.2, 2 }, { 0, 1, 0.6875, 0.2, 2 } };
+	inline constexpr PPoint cut31[] = { { 0, 0.015625, 0.176282, 0.2, 2 }, { 0, 0.046875, 0.753423, 0.2, 2 }, { 0, 0.078125, 0.172179, 0.2, 2 }, { 0, 0.109375, 0.758346, 0.2, 2 }, { 0, 0.140625, 0.168077, 0.2, 2 }, { 0, 0.171875, 0.763269, 0.2, 2 }, { 0, 0.203125, 0.163974, 0.2, 2 }, { 0, 0.234375, 0.768192, 0.2, 2 }, { 0, 0.265625, 0.104346, 0.2, 2 }, { 0, 0.296875, 0.773115, 0.2, 2 }, { 0, 0.328125, 0.0994231, 0.2, 2 }, { 0, 0.359375, 0.778038, 0.2, 2 }, { 0, 0.390625, 0.0945, 0.2, 2 }, { 0, 0.421875, 0.782962, 0.2, 2 }, { 0, 0.453125, 0.0895769, 0.2, 2 }, { 0, 0.484375, 0.787885, 0.2, 2 }, { 0, 0.515625, 0.0846538, 0.2, 2 }, { 0, 0.546875, 0.792808, 0.2, 2 }, { 0, 0.578125, 0.0797308, 0.2, 2 }, { 0, 0.609375, 0.797731, 0.2, 2 }, { 0, 0.640625, 0.135256, 0.2, 2 }, { 0, 0.671875, 0.802654, 0.2, 2 }, { 0, 0.703125, 0.131154, 0.2, 2 }, { 0, 0.734375, 0.807577, 0.2, 2 }, { 0, 0.765625, 0.0649615, 0.2, 2 }, { 0, 0.796875, 0.8125, -0.306, 1 } };
+	inline constexpr PPoint cut32[] = { { 0, 0.0772541, 0.169872, 0.2, 2 }, { 0, 0.194057, 0.675023, 0.2, 2 }, { 0, 0.280379, 0.201939, 0.2, 2 }, { 0, 0.303432, 0.644731, 0.2, 2 }, { 0, 0.342879, 0.162735, 0.2, 2 }, { 0, 0.365932, 0.627422, 0.2, 2 }, { 0, 0.405379, 0.221672, 0.2, 2 }, { 0, 0.428432, 0.610112, 0.2, 2 }, { 0, 0.499129, 0.236472, 0.2, 2 }, { 0, 0.584682, 0.566838, 0.2, 2 }, { 0, 0.631557, 0.278063, 0.2, 2 }, { 0, 0.678432, 0.540874, 0.2, 2 }, { 0, 0.717879, 0.301115, 0.2, 2 }, { 0, 0.740932, 0.523565, 0.2, 2 }, { 0, 0.780379, 0.307822, 0.2, 2 }, { 0, 0.803432, 0.506255, 0.2, 2 }, { 0, 0.842879, 0.314529, 0.2, 2 }, { 0, 0.865932, 0.488946, 0.2, 2 }, { 0, 0.921004, 0.322912, 0.2, 2 }, { 0, 0.975307, 0.458654, 0.2, 2 } };
+	inline constexpr PPoint cut33[] = { { 0, 1e-08, 0.298903, -0, 1 }, { 0, 0.0625, 0.246379, -0, 1 }, { 0, 0.0625, 0.341817, -0, 1 }, { 0, 0.0625, 0.341817, -0, 1 }, { 0, 0.125, 0.246379, -0, 1 }, { 0, 0.125, 0.38473, -0, 1 }, { 0, 0.125, 0.38473, -0, 1 }, { 0, 0.1875, 0.246379, -0, 1 }, { 0, 0.1875, 0.427643, -0, 1 }, { 0, 0.1875, 0.427643, -0, 1 }, { 0, 0.25, 0.246379, -0, 1 }, { 0, 0.25, 0.470556, -0, 1 }, { 0, 0.25, 0.470556, -0, 1 }, { 0, 0.3125, 0.246379, -0, 1 }, { 0, 0.3125, 0.513469, -0, 1 }, { 0, 0.3125, 0.513469, -0, 1 }, { 0, 0.375, 0.246379, -0, 1 }, { 0, 0.375, 0.556383, -0, 1 }, { 0, 0.375, 0.556383, -0, 1 }, { 0, 0.4375, 0.246379, -0, 1 }, { 0, 0.4375, 0.599296, -0, 1 }, { 0, 0.4375, 0.599296, -0, 1 }, { 0, 0.5, 0.246379, -0, 1 }, { 0, 0.5, 0.642209, -0, 1 }, { 0, 0.5, 0.642209, -0, 1 }, { 0, 0.5625, 0.246379, -0, 1 }, { 0, 0.5625, 0.685122, -0, 1 }, { 0, 0.5625, 0.685122, -0, 1 }, { 0, 0.625, 0.246379, -0, 1 }, { 0, 0.625, 0.728035, -0, 1 }, { 0, 0.625, 0.728035, -0, 1 }, { 0, 0.6875, 0.246379, -0, 1 }, { 0, 0.6875, 0.770949, -0, 1 }, { 0, 0.6875, 0.770949, -0, 1 }, { 0, 0.75, 0.246379, -0, 1 }, { 0, 0.75, 0.813862, -0, 1 }, { 0, 0.75, 0.813862, -0, 1 }, { 0, 0.8125, 0.246379, -0, 1 }, { 0, 0.8125, 0.856775, -0, 1 }, { 0, 0.8125, 0.856775, -0, 1 }, { 0, 0.875, 0.246379, -0, 1 }, { 0, 0.875, 0.899688, -0, 1 }, { 0, 0.875, 0.899688, -0, 1 }, { 0, 0.9375, 0.246379, -0, 1 }, { 0, 0.9375, 0.942602, -0, 1 }, { 0, 0.9375, 0.942602, -0, 1 }, { 0, 1, 0.246379, -0, 1 }, { 0, 1, 0.985515, -0, 1 } };
+	inline constexpr PPoint cut34[] = { { 0, 1e-08, 0.435897, 0, 1 }, { 0, 0.03125, 0.36266, 0, 1 }, { 0, 0.0625, 0.471154, 0, 1 }, { 0, 0.0625, 0.471154, 0, 1 }, { 0, 0.09375, 0.339263, 0, 1 }, { 0, 0.125, 0.50641, 0, 1 }, { 0, 0.125, 0.50641, 0, 1 }, { 0, 0.15625, 0.315865, 0, 1 }, { 0, 0.1875, 0.541667, 0, 1 }, { 0, 0.1875, 0.541667, 0, 1 }, { 0, 0.21875, 0.292468, 0, 1 }, { 0, 0.25, 0.576923, 0, 1 }, { 0, 0.25, 0.576923, 0, 1 }, { 0, 0.28125, 0.269071, 0, 1 }, { 0, 0.3125, 0.612179, 0, 1 }, { 0, 0.3125, 0.612179, 0, 1 }, { 0, 0.34375, 0.245673, 0, 1 }, { 0, 0.375, 0.647436, 0, 1 }, { 0, 0.375, 0.647436, 0, 1 }, { 0, 0.40625, 0.222276, 0, 1 }, { 0, 0.4375, 0.682692, 0, 1 }, { 0, 0.4375, 0.682692, 0, 1 }, { 0, 0.46875, 0.198878, 0, 1 }, { 0, 0.5, 0.717949, 0, 1 }, { 0, 0.5, 0.717949, 0, 1 }, { 0, 0.53125, 0.175481, 0, 1 }, { 0, 0.5625, 0.753205, 0, 1 }, { 0, 0.5625, 0.753205, 0, 1 }, { 0, 0.59375, 0.152083, 0, 1 }, { 0, 0.625, 0.788462, 0, 1 }, { 0, 0.625, 0.788462, 0, 1 }, { 0, 0.65625, 0.128686, 0, 1 }, { 0, 0.6875, 0.823718, 0, 1 }, { 0, 0.6875, 0.823718, 0, 1 }, { 0, 0.71875, 0.105288, 0, 1 }, { 0, 0.75, 0.858974, 0, 1 }, { 0, 0.75, 0.858974, 0, 1 }, { 0, 0.78125, 0.081891, 0, 1 }, { 0, 0.8125, 0.894231, 0, 1 }, { 0, 0.8125, 0.894231, 0, 1 }, { 0, 0.84375, 0.0584936, 0, 1 }, { 0, 0.875, 0.929487, 0, 1 }, { 0, 0.875, 0.929487, 0, 1 }, { 0, 0.90625, 0.0350962, 0, 1 }, { 0, 0.9375, 0.964744, 0, 1 }, { 0, 0.9375, 0.964744, 0, 1 }, { 0, 0.96875, 0.0116987, 0, 1 }, { 0, 1, 1, 0, 1 } };
+	inline constexpr PPoint cut35[] = { { 0, 0, 0.125, 0, 1 }, { 0, 1, 0.75, 0, 1 } };
+	inline constexpr PPoint cut36[] = { { 0, 1e-08, 0.75, -0, 1 }, { 0, 0.015625, 0.25, -0, 1 }, { 0, 0.015625, 0.75, -0, 1 }, { 0, 0.015625, 0.75, -0, 1 }, { 0, 0.03125, 0.25, -0, 1 }, { 0, 0.03125, 0.75, -0, 1 }, { 0, 0.03125, 0.75, -0, 1 }, { 0, 0.046875, 0.25, -0, 1 }, { 0, 0.046875, 0.75, -0, 1 }, { 0, 0.046875, 0.75, -0, 1 }, { 0, 0.0625, 0.25, -0, 1 }, { 0, 0.0625, 0.75, -0, 1 }, { 0, 0.0625, 0.75, -0, 1 }, { 0, 0.078125, 0.25, -0, 1 }, { 0, 0.078125, 0.75, -0, 1 }, { 0, 0.078125, 0.75, -0, 1 }, { 0, 0.09375, 0.25, -0, 1 }, { 0, 0.09375, 0.75, -0, 1 }, { 0, 0.09375, 0.75, -0, 1 }, { 0, 0.109375, 0.25, -0, 1 }, { 0, 0.109375, 0.75, -0, 1 }, { 0, 0.109375, 0.75, -0, 1 }, { 0, 0.125, 0.25, -0, 1 }, { 0, 0.125, 0.75, -0, 1 }, { 0, 0.125, 0.75, -0, 1 }, { 0, 0.140625, 0.25, -0, 1 }, { 0, 0.140625, 0.75, -0, 1 }, { 0, 0.140625, 0.75, -0, 1 }, { 0, 0.15625, 0.25, -0, 1 }, { 0, 0.15625, 0.75, -0, 1 }, { 0, 0.15625, 0.75, -0, 1 }, { 0, 0.171875, 0.25, -0, 1 }, { 0, 0.171875, 0.75, -0, 1 }, { 0, 0.171875, 0.75, -0, 1 }, { 0, 0.1875, 0.25, -0, 1 }, { 0, 0.1875, 0.75, -0, 1 }, { 0, 0.1875, 0.75, -0, 1 }, { 0, 0.203125, 0.25, -0, 1 }, { 0, 0.203125, 0.75, -0, 1 }, { 0, 0.203125, 0.75, -0, 1 }, { 0, 0.21875, 0.25, -0, 1 }, { 0, 0.21875, 0.75, -0, 1 }, { 0, 0.21875, 0.75, -0, 1 }, { 0, 0.234375, 0.25, -0, 1 }, { 0, 0.234375, 0.75, -0, 1 }, { 0, 0.234375, 0.75, -0, 1 }, { 0, 0.25, 0.25, -0, 1 }, { 0, 0.25, 0.75, -0, 1 }, { 0, 0.25, 0.75, -0, 1 }, { 0, 0.28125, 0.3125, -0, 1 }, { 0, 0.28125, 0.75, -0, 1 }, { 0, 0.28125, 0.75, -0, 1 }, { 0, 0.3125, 0.3125, -0, 1 }, { 0, 0.3125, 0.75, -0, 1 }, { 0, 0.3125, 0.75, -0, 1 }, { 0, 0.34375, 0.25, -0, 1 }, { 0, 0.34375, 0.75, -0, 1 }, { 0, 0.34375, 0.75, -0, 1 }, { 0, 0.375, 0.25, -0, 1 }, { 0, 0.375, 0.75, -0, 1 }, { 0, 0.375, 0.75, -0, 1 }, { 0, 0.40625, 0.25, -0, 1 }, { 0, 0.40625, 0.75, -0, 1 }, { 0, 0.40625, 0.75, -0, 1 }, { 0, 0.4375, 0.25, -0, 1 }, { 0, 0.4375, 0.75, -0, 1 }, { 0, 0.4375, 0.75, -0, 1 }, { 0, 0.46875, 0.25, -0, 1 }, { 0, 0.46875, 0.75, -0, 1 }, { 0, 0.46875, 0.75, -0, 1 }, { 0, 0.5, 0.25, -0, 1 }, { 0, 0.5, 0.75, -0, 1 }, { 0, 0.5, 0.75, -0, 1 }, { 0, 0.5625, 0.1875, -0, 1 }, { 0, 0.5625, 0.75, -0, 1 }, { 0, 0.5625, 0.75, -0, 1 }, { 0, 0.625, 0.1875, -0, 1 }, { 0, 0.625, 0.75, -0, 1 }, { 0, 0.625, 0.75, -0, 1 }, { 0, 0.6875, 0.1875, -0, 1 }, { 0, 0.6875, 0.75, -0, 1 }, { 0, 0.6875, 0.75, -0, 1 }, { 0, 0.75, 0.1875, -0, 1 }, { 0, 0.75, 0.75, -0, 1 }, { 0, 0.75, 0.75, -0, 1 }, { 0, 0.875, 0.1875, -0, 1 }, { 0, 0.875, 0.75, -0, 1 }, { 0, 0.875, 0.75, -0, 1 }, { 0, 1, 0.1875, -0, 1 }, { 0, 1, 0.75, -0, 1 } };
+	inline constexpr PPoint cut37[] = { { 0, 0, 0.321875, 0.276, 1 }, { 0, 0.0625, 0.64375, 0.324, 1 }, { 0, 0.125, 0.321875, 0, 1 }, { 0, 0.125, 0.321875, 0.276, 1 }, { 0, 0.1875, 0.64375, 0.228, 1 }, { 0, 0.25, 0.321875, 0, 1 }, { 0, 0.25, 0.321875, 0.276, 1 }, { 0, 0.3125, 0.64375, 0.228, 1 }, { 0, 0.375, 0.321875, 0, 1 }, { 0, 0.375, 0.321875, 0.276, 1 }, { 0, 0.4375, 0.64375, 0.228, 1 }, { 0, 0.5, 0.321875, 0, 1 }, { 0, 0.5, 0.321875, 0.276, 1 }, { 0, 0.5625, 0.64375, 0.324, 1 }, { 0, 0.625, 0.321875, 0, 1 }, { 0, 0.625, 0.321875, 0.276, 1 }, { 0, 0.6875, 0.64375, 0.228, 1 }, { 0, 0.75, 0.321875, 0, 1 }, { 0, 0.75, 0.321875, 0.276, 1 }, { 0, 0.8125, 0.64375, 0.228, 1 }, { 0, 0.875, 0.321875, 0, 1 }, { 0, 0.875, 0.321875, 0.276, 1 }, { 0, 0.9375, 0.64375, 0.228, 1 }, { 0, 1, 0.321875, 0, 1 } };
+	inline constexpr PPoint cut38[] = { { 0, 0, 0.5, 0, 1 }, { 0, 0.125, 0.5, 0, 1 }, { 0, 0.125, 0.375, 0.308, 1 }, { 0, 0.3125, 0.5, 0, 1 }, { 0, 0.375, 0.5, 0, 1 }, { 0, 0.375, 0.375, 0.386, 1 }, { 0, 0.625, 0.5, 0, 1 }, { 0, 0.75, 0.5, 0, 1 }, { 0, 0.75, 0.375, 0.252, 1 } };
 
-	static const std::vector<std::string>& getResPresets() {
-		static const std::vector<std::string> presets = {
-			"", // HEAD Basic 1-12
-			"0.25 0.25 0 2 0.75 0.75 0 1 ",
-			"0 1 -0.006 1 0.25 0.6875 0 1 0.375 0.6875 0 1 0.5 0.875 0 1 0.625 0.875 0 1 0.75 0.625 0 1 ",
-			"0 1 -0.15 1 0.503257 0.335 0.172 1 ",
-			"0 0.788529 0.29 1 0.75 0.168971 0.342 1 ",
-			"1e-08 0.5 0 1 0.0625 0.5 0 1 0.0625 0.375 0 1 0.125 0.375 0 1 0.125 0.125 0 1 0.25 0.125 0 1 0.25 0.375 0 1 0.375 0.375 0 1 0.375 0.6875 0 1 0.5 0.375 0 1 0.5 0.375 0 1 0.625 0.375 0 1 0.625 0.25 0 1 0.75 0.25 0 1 0.75 0.375 0 1 0.875 0.375 0 1 0.875 0.625 0 1 1 0.625 0 1 ",
-			"1e-08 0.5625 0 1 0.125 0.5625 0 1 0.125 0.25 0 1 0.25 0.25 0 1 0.25 0.625 0 1 0.375 0.625 0 1 0.375 0.25 0 1 0.5 0.25 0 1 0.5 0.6875 0 1 0.625 0.6875 0 1 0.625 0.5 0 1 0.75 0.5 0 1 0.75 0.625 0 1 0.875 0.625 0 1 0.875 0.25 0 1 1 0.25 0 1 ",
-			"0 1 0 1 1e-08 0.8125 0 0 0.25 0.5625 0 0 0.375 0.5 0 0 0.5 0.625 0 0 0.625 0.75 0 0 0.75 0.6875 0 0 0.8125 0.625 0 0 0.875 0.6875 0 0 0.9375 0.625 0 0 ",
-			"0.125 0.6875 0 1 0.125 0.375 0.278 1 0.5 0.6875 0 1 0.5 0.375 0.328 1 0.8125 0.6875 0 1 0.8125 0.375 0.316 1 ",
-			"0.125 0.4375 0 1 0.1875 0.625 0 1 0.375 0.375 0 1 0.4375 0.8125 0 1 0.4375 0.8125 0 1 0.625 0.375 0 1 0.6875 0.8125 0 1 0.875 0.5 0 1 0.9375 0.6875 0 1 ",
-			"0 0.5675 0 1 ",
-			"0 0.9975 0 1 0.75 0.5 0 1 ",
-			"1e-08 1 0 1 1.00062e-08 0.25 0 1 0.0625 1 0 1 0.0625 1 0 1 0.0625 0.25 0 1 0.125 1 0 1 0.125 1 0 1 0.125 0.25 0 1 0.25 1 0 1 0.25 1 0 1 0.25 0.25 0 1 0.3125 1 0 1 0.3125 1 0 1 0.3125 0.25 0 1 0.375 1 0 1 0.375 1 0 1 0.375 0.25 0 1 0.5 1 0 1 0.5 1 0 1 0.5 0.3125 0 1 0.5625 1 0 1 0.5625 1 0 1 0.5625 0.25 0 1 0.625 1 0 1 0.625 1 0 1 0.625 0.25 0 1 0.75 1 0 1 0.75 1 0 1 0.75 0.25 0 1 0.8125 1 0 1 0.8125 1 0 1 0.8125 0.25 0 1 0.9375 1 0 1 0.9375 1 0 1 0.9375 0.1875 0 1 1 1 0 1 ",
-
-			"", // HEAD Gated 1-12
-			"0 0.6875 0.448 1 0.125 0.446429 0.018 1 0.25 0.6875 0 1 0.3125 0.6875 0 1 0.3125 0.3125 0 1 0.4375 0.6875 0 1 0.5 0.6875 0.37 1 0.5 0.6875 0 1 0.5 0.446429 0 1 0.625 0.6875 0 1 0.625 0.473214 0 1 0.75 0.6875 0 1 0.8125 0.6875 0 1 0.8125 0.5 0 1 1 0.6875 0 1 ",
-			"0 0.49 0 1 ",
-			"1e-08 0.657085 0 1 1.0025e-08 0.300093 0 1 0.25 0.657085 0 1 0.25 0.657085 0 1 0.25 0.300093 0 1 0.5 0.658394 0 1 0.5 0.657085 0.542 1 0.5 0.300093 0 1 0.625 0.657085 0.306 1 0.625 0.300093 0 1 0.75 0.657085 0 1 0.75 0.657085 0 1 0.75 0.411653 0 1 0.8125 0.657085 0 1 0.8125 0.657085 0 1 0.8125 0.411653 0 1 0.875 0.657085 0 1 0.875 0.657085 0 1 0.875 0.322405 0 1 1 0.657085 0 1 ",
-			"1e-08 0.987136 0 1 1.00125e-08 0.493568 0 1 0.125 0.987136 0 1 0.125 0.987136 0 1 0.125 0.431872 0 1 0.1875 0.987136 0 1 0.1875 0.987136 0 1 0.1875 0 0 1 0.25 0.987136 0 1 0.25 0.987136 0 1 0.25 0 0 1 0.5 0.987136 0 1 0.5 0.987136 0 1 0.625 0.987136 0 1 0.625 0.987136 0 1 0.625 0 0 1 0.75 0.987136 0 1 0.75 0.987136 0 1 0.75 0.493568 0 1 0.78125 0.987136 0 1 0.78125 0.987136 0 1 0.78125 0.431872 0 1 0.8125 0.987136 0 1 0.8125 0.987136 0 1 0.8125 0.493568 0 1 0.84375 0.987136 0 1 0.84375 0.987136 0 1 0.84375 0.431872 0 1 0.875 0.987136 0 1 0.875 0.987136 0 1 0.875 0.061696 0 1 1 0.987136 0 1 ",
-			"0 0.75 0 1 0.5 0.4375 0 1 ",
-			"0 0.625 -0.198 1 0.1875 0.3125 0.192 1 1 0.75 0 1 ",
-			"1e-09 0.852006 0.21 1 0.25 0.408023 0 1 0.25 0.408023 0 1 0.25 0.852006 0 1 0.3125 0.408023 0 1 0.3125 0.408023 0 1 0.3125 0.852006 0 1 0.375 0.408023 0 1 0.375 0.408023 0 1 0.375 0.852006 0 1 0.5 0.408023 0 1 0.5 0.408023 0 1 0.5 0.815007 0 1 0.5625 0.408023 0 1 0.5625 0.408023 0 1 0.5625 0.852006 0 1 0.625 0.408023 0 1 0.625 0.408023 0 1 0.625 0.852006 0 1 0.75 0.408023 0 1 0.75 0.408023 0 1 0.75 0.852006 0 1 0.8125 0.408023 0 1 0.8125 0.408023 0 1 0.8125 0.852006 0 1 0.9375 0.408023 0 1 0.9375 0.408023 0 1 0.9375 0.889004 0 1 1 0.408023 0 1 ",
-			"1e-08 0.695 0 1 0.125 0.695 0 1 0.125 0.504375 0 1 0.25 1 0 1 0.25 1 0 1 0.25 0.580625 0 1 0.375 1 0 1 0.375 0.656875 0 1 0.5 0.656875 0 1 0.5 0.656875 0 1 0.625 1 0 1 0.625 1 0 1 0.625 0.5425 0 1 0.6875 1 0 1 0.6875 1 0 1 0.6875 0.5425 0 1 0.75 1 0 1 0.75 0.92375 0 1 0.75 0.656875 0 1 0.875 0.92375 0 1 0.875 1 0 1 0.875 0.5425 0 1 0.9375 1 0 1 0.9375 1 0 1 0.9375 0.5425 0 1 1 1 0 1 ",
-			"0 0.875 0.186 1 1 0.3125 -0.224 1 ",
-			"0 1 0 1 ",
-			"0 0.935 0 1 ",
-			"0 1 0 1 ",
-
-			"", // Other / FX (1-6 Waves, 7-12 FX)
-			"0.0625 0.8125 0 1 0.34375 0.375 0 1 0.6875 0.78125 0 1 0.9375 0.3125 0 1 ",
-			"0 1 0 1 ",
-			"0.25 0.725475 0.318 1 0.625 0.576657 0.18 1",
-			"0 0.872 0 1 1e-08 0.2725 -0.144 1 0.25 0.2725 0 1 0.625 0.654 0 1 1 0.654 0 1",
-			"0 0.9975 0 1 ",
-			"0 1 0 1 0.125 0.5 0 0 0.5 0.6875 0 0 ",
-			"0 1 0 1 1e-08 0.125 -0.014 1 1 0.875 0 1 ",
-			"0 1 0 1 ",
-			"1e-08 1 0 1 0.03125 0 0 1 0.0625 1 0 1 0.0625 1 0 1 0.09375 0 0 1 0.125 1 0 1 0.125 1 0 1 0.15625 0 0 1 0.1875 1 0 1 0.1875 1 0 1 0.21875 0 0 1 0.25 1 0 1 0.25 1 0 1 0.28125 0.0625 0 1 0.3125 1 0 1 0.3125 1 0 1 0.34375 0.0625 0 1 0.375 1 0 1 0.375 1 0 1 0.40625 0.0625 0 1 0.4375 1 0 1 0.4375 1 0 1 0.46875 0.0625 0 1 0.5 1 0 1 0.5 1 0 1 0.53125 0.125 0 1 0.5625 1 0 1 0.5625 1 0 1 0.59375 0.125 0 1 0.625 1 0 1 0.625 1 0 1 0.65625 0.1875 0 1 0.6875 1 0 1 0.6875 1 0 1 0.71875 0.1875 0 1 0.75 1 0 1 0.75 1 0 1 0.78125 0.1875 0 1 0.8125 1 0 1 0.8125 1 0 1 0.84375 0.25 0 1 0.875 1 0 1 0.875 0.9375 0 1 0.90625 0.25 0 1 0.9375 0.9375 0 1 0.9375 1 0 1 0.96875 0.3125 0 1 1 1 0 1 ",
-			"0 0.689744 0.32 1 1 0.346154 0 0 ",
-			"0 0.321587 0 1 0.5 0.931796 0 1 ",
-			"0.125 0.6875 0 1 0.125 0.375 0.278 1 0.5 0.6875 0 1 0.5 0.375 0.328 1 0.8125 0.6875 0 1 0.8125 0.375 0.316 1 ",
-		};
-		return presets;
-	}
+	// Resonance presets
+	inline constexpr PPoint res1[] = { { 0, 0.25, 0.25, 0, 2 }, { 0, 0.75, 0.75, 0, 1 } };
+	inline constexpr PPoint res2[] = { { 0, 0, 1, -0.006, 1 }, { 0, 0.25, 0.6875, 0, 1 }, { 0, 0.375, 0.6875, 0, 1 }, { 0, 0.5, 0.875, 0, 1 }, { 0, 0.625, 0.875, 0, 1 }, { 0, 0.75, 0.625, 0, 1 } };
+	inline constexpr PPoint res3[] = { { 0, 0, 1, -0.15, 1 }, { 0, 0.503257, 0.335, 0.172, 1 } };
+	inline constexpr PPoint res4[] = { { 0, 0, 0.788529, 0.29, 1 }, { 0, 0.75, 0.168971, 0.342, 1 } };
+	inline constexpr PPoint res5[] = { { 0, 1e-08, 0.5, 0, 1 }, { 0, 0.0625, 0.5, 0, 1 }, { 0, 0.0625, 0.375, 0, 1 }, { 0, 0.125, 0.375, 0, 1 }, { 0, 0.125, 0.125, 0, 1 }, { 0, 0.25, 0.125, 0, 1 }, { 0, 0.25, 0.375, 0, 1 }, { 0, 0.375, 0.375, 0, 1 }, { 0, 0.375, 0.6875, 0, 1 }, { 0, 0.5, 0.375, 0, 1 }, { 0, 0.5, 0.375, 0, 1 }, { 0, 0.625, 0.375, 0, 1 }, { 0, 0.625, 0.25, 0, 1 }, { 0, 0.75, 0.25, 0, 1 }, { 0, 0.75, 0.375, 0, 1 }, { 0, 0.875, 0.375, 0, 1 }, { 0, 0.875, 0.625, 0, 1 }, { 0, 1, 0.625, 0, 1 } };
+	inline constexpr PPoint res6[] = { { 0, 1e-08, 0.5625, 0, 1 }, { 0, 0.125, 0.5625, 0, 1 }, { 0, 0.125, 0.25, 0, 1 }, { 0, 0.25, 0.25, 0, 1 }, { 0, 0.25, 0.625, 0, 1 }, { 0, 0.375, 0.625, 0, 1 }, { 0, 0.375, 0.25, 0, 1 }, { 0, 0.5, 0.25, 0, 1 }, { 0, 0.5, 0.6875, 0, 1 }, { 0, 0.625, 0.6875, 0, 1 }, { 0, 0.625, 0.5, 0, 1 }, { 0, 0.75, 0.5, 0, 1 }, { 0, 0.75, 0.625, 0, 1 }, { 0, 0.875, 0.625, 0, 1 }, { 0, 0.875, 0.25, 0, 1 }, { 0, 1, 0.25, 0, 1 } };
+	inline constexpr PPoint res7[] = { { 0, 0, 1, 0, 1 }, { 0, 1e-08, 0.8125, 0, 0 }, { 0, 0.25, 0.5625, 0, 0 }, { 0, 0.375, 0.5, 0, 0 }, { 0, 0.5, 0.625, 0, 0 }, { 0, 0.625, 0.75, 0, 0 }, { 0, 0.75, 0.6875, 0, 0 }, { 0, 0.8125, 0.625, 0, 0 }, { 0, 0.875, 0.6875, 0, 0 }, { 0, 0.9375, 0.625, 0, 0 } };
+	inline constexpr PPoint res8[] = { { 0, 0.125, 0.6875, 0, 1 }, { 0, 0.125, 0.375, 0.278, 1 }, { 0, 0.5, 0.6875, 0, 1 }, { 0, 0.5, 0.375, 0.328, 1 }, { 0, 0.8125, 0.6875, 0, 1 }, { 0, 0.8125, 0.375, 0.316, 1 } };
+	inline constexpr PPoint res9[] = { { 0, 0.125, 0.4375, 0, 1 }, { 0, 0.1875, 0.625, 0, 1 }, { 0, 0.375, 0.375, 0, 1 }, { 0, 0.4375, 0.8125, 0, 1 }, { 0, 0.4375, 0.8125, 0, 1 }, { 0, 0.625, 0.375, 0, 1 }, { 0, 0.6875, 0.8125, 0, 1 }, { 0, 0.875, 0.5, 0, 1 }, { 0, 0.9375, 0.6875, 0, 1 } };
+	inline constexpr PPoint res10[] = { { 0, 0, 0.5675, 0, 1 } };
+	inline constexpr PPoint res11[] = { { 0, 0, 0.9975, 0, 1 }, { 0, 0.75, 0.5, 0, 1 } };
+	inline constexpr PPoint res12[] = { { 0, 1e-08, 1, 0, 1 }, { 0, 1.00062e-08, 0.25, 0, 1 }, { 0, 0.0625, 1, 0, 1 }, { 0, 0.0625, 1, 0, 1 }, { 0, 0.0625, 0.25, 0, 1 }, { 0, 0.125, 1, 0, 1 }, { 0, 0.125, 1, 0, 1 }, { 0, 0.125, 0.25, 0, 1 }, { 0, 0.25, 1, 0, 1 }, { 0, 0.25, 1, 0, 1 }, { 0, 0.25, 0.25, 0, 1 }, { 0, 0.3125, 1, 0, 1 }, { 0, 0.3125, 1, 0, 1 }, { 0, 0.3125, 0.25, 0, 1 }, { 0, 0.375, 1, 0, 1 }, { 0, 0.375, 1, 0, 1 }, { 0, 0.375, 0.25, 0, 1 }, { 0, 0.5, 1, 0, 1 }, { 0, 0.5, 1, 0, 1 }, { 0, 0.5, 0.3125, 0, 1 }, { 0, 0.5625, 1, 0, 1 }, { 0, 0.5625, 1, 0, 1 }, { 0, 0.5625, 0.25, 0, 1 }, { 0, 0.625, 1, 0, 1 }, { 0, 0.625, 1, 0, 1 }, { 0, 0.625, 0.25, 0, 1 }, { 0, 0.75, 1, 0, 1 }, { 0, 0.75, 1, 0, 1 }, { 0, 0.75, 0.25, 0, 1 }, { 0, 0.8125, 1, 0, 1 }, { 0, 0.8125, 1, 0, 1 }, { 0, 0.8125, 0.25, 0, 1 }, { 0, 0.9375, 1, 0, 1 }, { 0, 0.9375, 1, 0, 1 }, { 0, 0.9375, 0.1875, 0, 1 }, { 0, 1, 1, 0, 1 } };
+
+	inline constexpr PPoint res14[] = { { 0, 0, 0.6875, 0.448, 1 }, { 0, 0.125, 0.446429, 0.018, 1 }, { 0, 0.25, 0.6875, 0, 1 }, { 0, 0.3125, 0.6875, 0, 1 }, { 0, 0.3125, 0.3125, 0, 1 }, { 0, 0.4375, 0.6875, 0, 1 }, { 0, 0.5, 0.6875, 0.37, 1 }, { 0, 0.5, 0.6875, 0, 1 }, { 0, 0.5, 0.446429, 0, 1 }, { 0, 0.625, 0.6875, 0, 1 }, { 0, 0.625, 0.473214, 0, 1 }, { 0, 0.75, 0.6875, 0, 1 }, { 0, 0.8125, 0.6875, 0, 1 }, { 0, 0.8125, 0.5, 0, 1 }, { 0, 1, 0.6875, 0, 1 } };
+	inline constexpr PPoint res15[] = { { 0, 0, 0.49, 0, 1 } };
+	inline constexpr PPoint res16[] = { { 0, 1e-08, 0.657085, 0, 1 }, { 0, 1.0025e-08, 0.300093, 0, 1 }, { 0, 0.25, 0.657085, 0, 1 }, { 0, 0.25, 0.657085, 0, 1 }, { 0, 0.25, 0.300093, 0, 1 }, { 0, 0.5, 0.658394, 0, 1 }, { 0, 0.5, 0.657085, 0.542, 1 }, { 0, 0.5, 0.300093, 0, 1 }, { 0, 0.625, 0.657085, 0.306, 1 }, { 0, 0.625, 0.300093, 0, 1 }, { 0, 0.75, 0.657085, 0, 1 }, { 0, 0.75, 0.657085, 0, 1 }, { 0, 0.75, 0.411653, 0, 1 }, { 0, 0.8125, 0.657085, 0, 1 }, { 0, 0.8125, 0.657085, 0, 1 }, { 0, 0.8125, 0.411653, 0, 1 }, { 0, 0.875, 0.657085, 0, 1 }, { 0, 0.875, 0.657085, 0, 1 }, { 0, 0.875, 0.322405, 0, 1 }, { 0, 1, 0.657085, 0, 1 } };
+	inline constexpr PPoint res17[] = { { 0, 1e-08, 0.987136, 0, 1 }, { 0, 1.00125e-08, 0.493568, 0, 1 }, { 0, 0.125, 0.987136, 0, 1 }, { 0, 0.125, 0.987136, 0, 1 }, { 0, 0.125, 0.431872, 0, 1 }, { 0, 0.1875, 0.987136, 0, 1 }, { 0, 0.1875, 0.987136, 0, 1 }, { 0, 0.1875, 0, 0, 1 }, { 0, 0.25, 0.987136, 0, 1 }, { 0, 0.25, 0.987136, 0, 1 }, { 0, 0.25, 0, 0, 1 }, { 0, 0.5, 0.987136, 0, 1 }, { 0, 0.5, 0.987136, 0, 1 }, { 0, 0.625, 0.987136, 0, 1 }, { 0, 0.625, 0.987136, 0, 1 }, { 0, 0.625, 0, 0, 1 }, { 0, 0.75, 0.987136, 0, 1 }, { 0, 0.75, 0.987136, 0, 1 }, { 0, 0.75, 0.493568, 0, 1 }, { 0, 0.78125, 0.987136, 0, 1 }, { 0, 0.78125, 0.987136, 0, 1 }, { 0, 0.78125, 0.431872, 0, 1 }, { 0, 0.8125, 0.987136, 0, 1 }, { 0, 0.8125, 0.987136, 0, 1 }, { 0, 0.8125, 0.493568, 0, 1 }, { 0, 0.84375, 0.987136, 0, 1 }, { 0, 0.84375, 0.987136, 0, 1 }, { 0, 0.84375, 0.431872, 0, 1 }, { 0, 0.875, 0.987136, 0, 1 }, { 0, 0.875, 0.987136, 0, 1 }, { 0, 0.875, 0.061696, 0, 1 }, { 0, 1, 0.987136, 0, 1 } };
+	inline constexpr PPoint res18[] = { { 0, 0, 0.75, 0, 1 }, { 0, 0.5, 0.4375, 0, 1 } };
+	inline constexpr PPoint res19[] = { { 0, 0, 0.625, -0.198, 1 }, { 0, 0.1875, 0.3125, 0.192, 1 }, { 0, 1, 0.75, 0, 1 } };
+	inline constexpr PPoint res20[] = { { 0, 1e-09, 0.852006, 0.21, 1 }, { 0, 0.25, 0.408023, 0, 1 }, { 0, 0.25, 0.408023, 0, 1 }, { 0, 0.25, 0.852006, 0, 1 }, { 0, 0.3125, 0.408023, 0, 1 }, { 0, 0.3125, 0.408023, 0, 1 }, { 0, 0.3125, 0.852006, 0, 1 }, { 0, 0.375, 0.408023, 0, 1 }, { 0, 0.375, 0.408023, 0, 1 }, { 0, 0.375, 0.852006, 0, 1 }, { 0, 0.5, 0.408023, 0, 1 }, { 0, 0.5, 0.408023, 0, 1 }, { 0, 0.5, 0.815007, 0, 1 }, { 0, 0.5625, 0.408023, 0, 1 }, { 0, 0.5625, 0.408023, 0, 1 }, { 0, 0.5625, 0.852006, 0, 1 }, { 0, 0.625, 0.408023, 0, 1 }, { 0, 0.625, 0.408023, 0, 1 }, { 0, 0.625, 0.852006, 0, 1 }, { 0, 0.75, 0.408023, 0, 1 }, { 0, 0.75, 0.408023, 0, 1 }, { 0, 0.75, 0.852006, 0, 1 }, { 0, 0.8125, 0.408023, 0, 1 }, { 0, 0.8125, 0.408023, 0, 1 }, { 0, 0.8125, 0.852006, 0, 1 }, { 0, 0.9375, 0.408023, 0, 1 }, { 0, 0.9375, 0.408023, 0, 1 }, { 0, 0.9375, 0.889004, 0, 1 }, { 0, 1, 0.408023, 0, 1 } };
+	inline constexpr PPoint res21[] = { { 0, 1e-08, 0.695, 0, 1 }, { 0, 0.125, 0.695, 0, 1 }, { 0, 0.125, 0.504375, 0, 1 }, { 0, 0.25, 1, 0, 1 }, { 0, 0.25, 1, 0, 1 }, { 0, 0.25, 0.580625, 0, 1 }, { 0, 0.375, 1, 0, 1 }, { 0, 0.375, 0.656875, 0, 1 }, { 0, 0.5, 0.656875, 0, 1 }, { 0, 0.5, 0.656875, 0, 1 }, { 0, 0.625, 1, 0, 1 }, { 0, 0.625, 1, 0, 1 }, { 0, 0.625, 0.5425, 0, 1 }, { 0, 0.6875, 1, 0, 1 }, { 0, 0.6875, 1, 0, 1 }, { 0, 0.6875, 0.5425, 0, 1 }, { 0, 0.75, 1, 0, 1 }, { 0, 0.75, 0.92375, 0, 1 }, { 0, 0.75, 0.656875, 0, 1 }, { 0, 0.875, 0.92375, 0, 1 }, { 0, 0.875, 1, 0, 1 }, { 0, 0.875, 0.5425, 0, 1 }, { 0, 0.9375, 1, 0, 1 }, { 0, 0.9375, 1, 0, 1 }, { 0, 0.9375, 0.5425, 0, 1 }, { 0, 1, 1, 0, 1 } };
+	inline constexpr PPoint res22[] = { { 0, 0, 0.875, 0.186, 1 }, { 0, 1, 0.3125, -0.224, 1 } };
+	inline constexpr PPoint res23[] = { { 0, 0, 1, 0, 1 } };
+	inline constexpr PPoint res24[] = { { 0, 0, 0.935, 0, 1 } };
+	inline constexpr PPoint res25[] = { { 0, 0, 1, 0, 1 } };
+
+	inline constexpr PPoint res27[] = { { 0, 0.0625, 0.8125, 0, 1 }, { 0, 0.34375, 0.375, 0, 1 }, { 0, 0.6875, 0.78125, 0, 1 }, { 0, 0.9375, 0.3125, 0, 1 } };
+	inline constexpr PPoint res28[] = { { 0, 0, 1, 0, 1 } };
+	inline constexpr PPoint res29[] = { { 0, 0.25, 0.725475, 0.318, 1 }, { 0, 0.625, 0.576657, 0.18, 1 } };
+	inline constexpr PPoint res30[] = { { 0, 0, 0.872, 0, 1 }, { 0, 1e-08, 0.2725, -0.144, 1 }, { 0, 0.25, 0.2725, 0, 1 }, { 0, 0.625, 0.654, 0, 1 }, { 0, 1, 0.654, 0, 1 } };
+	inline constexpr PPoint res31[] = { { 0, 0, 0.9975, 0, 1 } };
+	inline constexpr PPoint res32[] = { { 0, 0, 1, 0, 1 }, { 0, 0.125, 0.5, 0, 0 }, { 0, 0.5, 0.6875, 0, 0 } };
+	inline constexpr PPoint res33[] = { { 0, 0, 1, 0, 1 }, { 0, 1e-08, 0.125, -0.014, 1 }, { 0, 1, 0.875, 0, 1 } };
+	inline constexpr PPoint res34[] = { { 0, 0, 1, 0, 1 } };
+	inline constexpr PPoint res35[] = { { 0, 1e-08, 1, 0, 1 }, { 0, 0.03125, 0, 0, 1 }, { 0, 0.0625, 1, 0, 1 }, { 0, 0.0625, 1, 0, 1 }, { 0, 0.09375, 0, 0, 1 }, { 0, 0.125, 1, 0, 1 }, { 0, 0.125, 1, 0, 1 }, { 0, 0.15625, 0, 0, 1 }, { 0, 0.1875, 1, 0, 1 }, { 0, 0.1875, 1, 0, 1 }, { 0, 0.21875, 0, 0, 1 }, { 0, 0.25, 1, 0, 1 }, { 0, 0.25, 1, 0, 1 }, { 0, 0.28125, 0.0625, 0, 1 }, { 0, 0.3125, 1, 0, 1 }, { 0, 0.3125, 1, 0, 1 }, { 0, 0.34375, 0.0625, 0, 1 }, { 0, 0.375, 1, 0, 1 }, { 0, 0.375, 1, 0, 1 }, { 0, 0.40625, 0.0625, 0, 1 }, { 0, 0.4375, 1, 0, 1 }, { 0, 0.4375, 1, 0, 1 }, { 0, 0.46875, 0.0625, 0, 1 }, { 0, 0.5, 1, 0, 1 }, { 0, 0.5, 1, 0, 1 }, { 0, 0.53125, 0.125, 0, 1 }, { 0, 0.5625, 1, 0, 1 }, { 0, 0.5625, 1, 0, 1 }, { 0, 0.59375, 0.125, 0, 1 }, { 0, 0.625, 1, 0, 1 }, { 0, 0.625, 1, 0, 1 }, { 0, 0.65625, 0.1875, 0, 1 }, { 0, 0.6875, 1, 0, 1 }, { 0, 0.6875, 1, 0, 1 }, { 0, 0.71875, 0.1875, 0, 1 }, { 0, 0.75, 1, 0, 1 }, { 0, 0.75, 1, 0, 1 }, { 0, 0.78125, 0.1875, 0, 1 }, { 0, 0.8125, 1, 0, 1 }, { 0, 0.8125, 1, 0, 1 }, { 0, 0.84375, 0.25, 0, 1 }, { 0, 0.875, 1, 0, 1 }, { 0, 0.875, 0.9375, 0, 1 }, { 0, 0.90625, 0.25, 0, 1 }, { 0, 0.9375, 0.9375, 0, 1 }, { 0, 0.9375, 1, 0, 1 }, { 0, 0.96875, 0.3125, 0, 1 }, { 0, 1, 1, 0, 1 } };
+	inline constexpr PPoint res36[] = { { 0, 0, 0.689744, 0.32, 1 }, { 0, 1, 0.346154, 0, 0 } };
+	inline constexpr PPoint res37[] = { { 0, 0, 0.321587, 0, 1 }, { 0, 0.5, 0.931796, 0, 1 } };
+	inline constexpr PPoint res38[] = { { 0, 0.125, 0.6875, 0, 1 }, { 0, 0.125, 0.375, 0.278, 1 }, { 0, 0.5, 0.6875, 0, 1 }, { 0, 0.5, 0.375, 0.328, 1 }, { 0, 0.8125, 0.6875, 0, 1 }, { 0, 0.8125, 0.375, 0.316, 1 } };
+
+	struct Table {
+		const PPoint* points;
+		size_t count;
+		const PPoint* begin() const { return points; }
+		const PPoint* end() const { return points + count; }
+		size_t size() const { return count; }
+		bool empty() const { return count == 0; }
+	};
+
+	inline constexpr Table paintPresets[] = {
+		{ paint0, std::size(paint0) }, // line
+		{ paint1, std::size(paint1) }, // Saw
+		{ paint2, std::size(paint2) }, // triangle
+		{ paint3, std::size(paint3) }, // square
+		{ paint4, std::size(paint4) }, // Fin
+		{ paint5, std::size(paint5) }, // S-Curve
+		{ paint6, std::size(paint6) }, // sine
+		{ paint7, std::size(paint7) }, // waves
+	};
 
-	static std::vector<PPoint> parsePreset(const std::string& str) {
-		std::vector<PPoint> result;
-		std::istringstream iss(str);
-		double x, y, tension;
-		int type;
+	inline constexpr Table cutPresets[] = {
+		{ nullptr, 0 }, // HEAD 1-12 Basic
+		{ cut1, std::size(cut1) },
+		{ cut2, std::size(cut2) },
+		{ cut3, std::size(cut3) },
+		{ cut4, std::size(cut4) },
+		{ cut5, std::size(cut5) },
+		{ cut6, std::size(cut6) },
+		{ cut7, std::size(cut7) },
+		{ cut8, std::size(cut8) },
+		{ cut9, std::size(cut9) },
+		{ cut10, std::size(cut10) },
+		{ cut11, std::size(cut11) },
+		{ cut12, std::size(cut12) },
 
-		if (str.empty()) {
-			return {};  // Return empty array if the string is empty
-		}
+		{ nullptr, 0 }, // HEAD 1-12 Gated
+		{ cut14, std::size(cut14) },
+		{ cut15, std::size(cut15) },
+		{ cut16, std::size(cut16) },
+		{ cut17, std::size(cut17) },
+		{ cut18, std::size(cut18) },
+		{ cut19, std::size(cut19) },
+		{ cut20, std::size(cut20) },
+		{ cut21, std::size(cut21) },
+		{ cut22, std::size(cut22) },
+		{ cut23, std::size(cut23) },
+		{ cut24, std::size(cut24) },
+		{ cut25, std::size(cut25) },
 
-		while (iss >> x >> y >> tension >> type) {
-			result.emplace_back(PPoint{0, x, y, tension, type});
-		}
+		{ nullptr, 0 }, // Other / FX (1-6 Waves, 7-12 FX)
+		{ cut27, std::size(cut27) },
+		{ cut28, std::size(cut28) },
+		{ cut29, std::size(cut29) },
+		{ cut30, std::size(cut30) },
+		{ cut31, std::size(cut31) },
+		{ cut32, std::size(cut32) },
+		{ cut33, std::size(cut33) },
+		{ cut34, std::size(cut34) },
+		{ cut35, std::size(cut35) },
+		{ cut36, std::size(cut36) },
+		{ cut37, std::size(cut37) },
+		{ cut38, std::size(cut38) },
+	};
 
-		return result;
+	inline constexpr Table resPresets[] = {
+		{ nullptr, 0 }, // HEAD Basic 1-12
+		{ res1, std::size(res1) },
+		{ res2, std::size(res2) },
+		{ res3, std::size(res3) },
+		{ res4, std::size(res4) },
+		{ res5, std::size(res5) },
+		{ res6, std::size(res6) },
+		{ res7, std::size(res7) },
+		{ res8, std::size(res8) },
+		{ res9, std::size(res9) },
+		{ res10, std::size(res10) },
+		{ res11, std::size(res11) },
+		{ res12, std::size(res12) },
+
+		{ nullptr, 0 }, // HEAD Gated 1-12
+		{ res14, std::size(res14) },
+		{ res15, std::size(res15) },
+		{ res16, std::size(res16) },
+		{ res17, std::size(res17) },
+		{ res18, std::size(res18) },
+		{ res19, std::size(res19) },
+		{ res20, std::size(res20) },
+		{ res21, std::size(res21) },
+		{ res22, std::size(res22) },
+		{ res23, std::size(res23) },
+		{ res24, std::size(res24) },
+		{ res25, std::size(res25) },
+
+		{ nullptr, 0 }, // Other / FX (1-6 Waves, 7-12 FX)
+		{ res27, std::size(res27) },
+		{ res28, std::size(res28) },
+		{ res29, std::size(res29) },
+		{ res30, std::size(res30) },
+		{ res31, std::size(res31) },
+		{ res32, std::size(res32) },
+		{ res33, std::size(res33) },
+		{ res34, std::size(res34) },
+		{ res35, std::size(res35) },
+		{ res36, std::size(res36) },
+		{ res37, std::size(res37) },
+		{ res38, std::size(res38) },
+	};
+}
+
+class Presets {
+public:
+	static presets::Table getCutPreset(int index) {
+		return getPreset(presets::cutPresets, std::size(presets::cutPresets), index);
+	}
+
+	static presets::Table getResPreset(int index) {
+		return getPreset(presets::resPresets, std::size(presets::resPresets), index);
+	}
+
+	static presets::Table getPaintPreset(int index) {
+		return getPreset(presets::paintPresets, std::size(presets::paintPresets), index);
+	}
+
+private:
+	static presets::Table getPreset(const presets::Table* tables, size_t count, int index) {
+		if (index < 0 || index >= static_cast<int>(count))
+			return { nullptr, 0 };
+		return tables[index];
 	}
-};
\ No newline at end of file
+};
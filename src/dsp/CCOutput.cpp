@@ -0,0 +1,90 @@
+#include "CCOutput.h"
+
+void CCOutput::reset()
+{
+	countdown = 0;
+	lastValue = -1;
+	lastMSB = -1;
+	lastLSB = -1;
+	nrpnSelected = false;
+	prevY = -1.0;
+}
+
+void CCOutput::setup(int channel_, int cc_, int mode_, bool bipolar_, int interval_, double deadband_)
+{
+	if (channel_ != channel || cc_ != cc || mode_ != mode || bipolar_ != bipolar)
+		reset();
+
+	channel = channel_;
+	cc = cc_;
+	mode = mode_;
+	bipolar = bipolar_;
+	interval = interval_;
+	deadband = deadband_;
+}
+
+void CCOutput::process(MidiBuffer& midi, const double* env, int numSamples, int oversampling)
+{
+	if (numSamples <= 0)
+		return;
+
+	if (interval <= 0) {
+		send(midi, env[0], 0);
+		return;
+	}
+
+	while (countdown < numSamples) {
+		send(midi, env[countdown * oversampling], countdown);
+		countdown += interval;
+	}
+	countdown -= numSamples;
+}
+
+void CCOutput::send(MidiBuffer& midi, double y, int offset)
+{
+	bool fine = mode == Mode::NRPN || (mode == Mode::CC14 && cc < 32);
+	int maxval = fine ? 16383 : 127;
+	int val = (int)std::round(y * maxval);
+
+	bool settled = std::fabs(y - prevY) < 1e-6;
+	prevY = y;
+
+	if (val == lastValue)
+		return;
+	if (lastValue != -1 && std::fabs(y - lastY) < deadband && !settled)
+		return;
+
+	lastValue = val;
+	lastY = y;
+
+	if (bipolar)
+		val = (val - (maxval + 1) / 2) & maxval; // signed two's complement, same as bipolar 7-bit CC
+
+	if (fine) {
+		int msbcc = cc;
+		int lsbcc = cc + 32;
+		if (mode == Mode::NRPN) {
+			msbcc = 6; // data entry
+			lsbcc = 38;
+			if (!nrpnSelected) {
+				midi.addEvent(MidiMessage::controllerEvent(channel, 99, (cc >> 7) & 127), offset);
+				midi.addEvent(MidiMessage::controllerEvent(channel, 98, cc & 127), offset);
+				nrpnSelected = true;
+			}
+		}
+
+		// receivers may clear the LSB when a new MSB arrives, so a changed MSB is always followed by its LSB
+		int msb = val >> 7;
+		int lsb = val & 127;
+		bool msbChanged = msb != lastMSB;
+		if (msbChanged)
+			midi.addEvent(MidiMessage::controllerEvent(channel, msbcc, msb), offset);
+		if (msbChanged || lsb != lastLSB)
+			midi.addEvent(MidiMessage::controllerEvent(channel, lsbcc, lsb), offset);
+		lastMSB = msb;
+		lastLSB = lsb;
+	}
+	else {
+		midi.addEvent(MidiMessage::controllerEvent(channel, cc, val), offset);
+	}
+}
@@ -0,0 +1,42 @@
+// Copyright 2025 tilr
+// MIDI CC output stream, sends the envelope as 7-bit CC, 14-bit CC pairs or NRPN
+// at a fixed sub block rate while dropping redundant values
+// 14-bit pairs only resend the MSB when it changes, NRPN selects the parameter number once per stream
+#pragma once
+
+#include <JuceHeader.h>
+
+class CCOutput
+{
+public:
+	enum Mode {
+		CC7,
+		CC14, // MSB on cc, LSB on cc + 32, only valid for cc 0..31, otherwise sends 7-bit
+		NRPN
+	};
+
+	CCOutput() {};
+	~CCOutput() {};
+
+	void reset(); // forget the last sent value so the next one is always sent
+	void setup(int channel, int cc, int mode, bool bipolar, int interval, double deadband);
+	void process(MidiBuffer& midi, const double* env, int numSamples, int oversampling);
+
+private:
+	void send(MidiBuffer& midi, double y, int offset);
+
+	int channel = 1; // MIDI channel 1..16
+	int cc = 0;
+	int mode = Mode::CC7;
+	bool bipolar = false;
+	int interval = 0; // samples between messages, 0 sends once per block
+	double deadband = 0.0; // minimum normalized change before sending, unless the envelope has settled
+
+	int countdown = 0; // samples until the next message
+	int lastValue = -1; // last sent value before bipolar offset
+	int lastMSB = -1; // last sent data bytes after bipolar offset, -1 when the stream restarts
+	int lastLSB = -1;
+	bool nrpnSelected = false; // NRPN parameter number was sent on this stream
+	double lastY = 0.0; // last sent envelope value
+	double prevY = -1.0; // envelope value on the previous tick
+};
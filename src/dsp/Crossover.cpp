@@ -0,0 +1,160 @@
+#include "Crossover.h"
+
+static constexpr double BUTTERWORTH_Q = 0.7071067811865476;
+
+void Crossover::Biquad::lp(double srate, double freq)
+{
+	double w0 = 2.0 * MathConstants<double>::pi * freq / srate;
+	double cosw = std::cos(w0);
+	double alpha = std::sin(w0) / (2.0 * BUTTERWORTH_Q);
+	double a0 = 1.0 + alpha;
+	b0 = (1.0 - cosw) / 2.0 / a0;
+	b1 = (1.0 - cosw) / a0;
+	b2 = b0;
+	a1 = -2.0 * cosw / a0;
+	a2 = (1.0 - alpha) / a0;
+}
+
+void Crossover::Biquad::hp(double srate, double freq)
+{
+	double w0 = 2.0 * MathConstants<double>::pi * freq / srate;
+	double cosw = std::cos(w0);
+	double alpha = std::sin(w0) / (2.0 * BUTTERWORTH_Q);
+	double a0 = 1.0 + alpha;
+	b0 = (1.0 + cosw) / 2.0 / a0;
+	b1 = -(1.0 + cosw) / a0;
+	b2 = b0;
+	a1 = -2.0 * cosw / a0;
+	a2 = (1.0 - alpha) / a0;
+}
+
+// matches the phase of an LR4 lowpass plus highpass pair at the same frequency
+void Crossover::Biquad::ap(double srate, double freq)
+{
+	double w0 = 2.0 * MathConstants<double>::pi * freq / srate;
+	double cosw = std::cos(w0);
+	double alpha = std::sin(w0) / (2.0 * BUTTERWORTH_Q);
+	double a0 = 1.0 + alpha;
+	b0 = (1.0 - alpha) / a0;
+	b1 = -2.0 * cosw / a0;
+	b2 = 1.0;
+	a1 = b1;
+	a2 = b0;
+}
+
+void Crossover::Biquad::clear()
+{
+	z1[0] = z1[1] = 0.0;
+	z2[0] = z2[1] = 0.0;
+}
+
+void Crossover::setLane(Vec& v, int lane, double value)
+{
+#if JUCE_USE_SIMD
+	v.set((size_t)lane, value);
+#else
+	(void)lane;
+	v = value;
+#endif
+}
+
+void Crossover::setCoeffs(Split& split, const Biquad& lp, const Biquad& hp)
+{
+	for (int lane = 0; lane < kSplitLanes; ++lane) {
+		auto& c = lane < 2 ? lp : hp;
+		for (auto& section : split.sections) {
+			auto& s = section[lane / kWidth];
+			int idx = lane % kWidth;
+			setLane(s.b0, idx, c.b0);
+			setLane(s.b1, idx, c.b1);
+			setLane(s.b2, idx, c.b2);
+			setLane(s.a1, idx, c.a1);
+			setLane(s.a2, idx, c.a2);
+		}
+	}
+}
+
+void Crossover::prepare(double srate_)
+{
+	srate = srate_;
+	updateCoeffs();
+	clear();
+}
+
+void Crossover::setup(int numBands_, const double* freqs)
+{
+	numBands = jlimit(2, kMaxBands, numBands_);
+	double sorted[kMaxBands - 1] = {};
+	for (int i = 0; i < numBands - 1; ++i)
+		sorted[i] = jlimit(20.0, srate * 0.45, freqs[i]);
+	std::sort(sorted, sorted + numBands - 1);
+
+	bool changed = false;
+	for (int i = 0; i < numBands - 1; ++i) {
+		changed = changed || splits[i].freq != sorted[i];
+		splits[i].freq = sorted[i];
+	}
+	if (changed)
+		updateCoeffs();
+}
+
+void Crossover::updateCoeffs()
+{
+	for (int i = 0; i < numBands - 1; ++i) {
+		auto& split = splits[i];
+		if (split.freq <= 0.0)
+			continue;
+		Biquad lp, hp;
+		lp.lp(srate, split.freq);
+		hp.hp(srate, split.freq);
+		setCoeffs(split, lp, hp);
+		for (int band = 0; band < i; ++band)
+			allpass[band][i].ap(srate, split.freq);
+	}
+}
+
+void Crossover::clear()
+{
+	for (auto& split : splits) {
+		for (auto& section : split.sections) {
+			for (auto& s : section) {
+				s.z1 = Vec {};
+				s.z2 = Vec {};
+			}
+		}
+	}
+	for (auto& band : allpass) {
+		for (auto& ap : band)
+			ap.clear();
+	}
+}
+
+void Crossover::process(double left, double right, double* outL, double* outR)
+{
+	double x[2] = { left, right };
+	for (int i = 0; i < numBands - 1; ++i) {
+		auto& split = splits[i];
+		// both sides of the split filter the same input, idle lanes are fed silence
+		alignas(32) double lanes[kGroups * kWidth] = { x[0], x[1], x[0], x[1] };
+		for (int g = 0; g < kGroups; ++g) {
+#if JUCE_USE_SIMD
+			auto v = Vec::fromRawArray(lanes + g * kWidth);
+			v = split.sections[1][g].process(split.sections[0][g].process(v));
+			v.copyToRawArray(lanes + g * kWidth);
+#else
+			lanes[g] = split.sections[1][g].process(split.sections[0][g].process(lanes[g]));
+#endif
+		}
+		double lo[2] = { lanes[0], lanes[1] };
+		x[0] = lanes[2];
+		x[1] = lanes[3];
+
+		for (int j = i + 1; j < numBands - 1; ++j)
+			allpass[i][j].process(lo);
+
+		outL[i] = lo[0];
+		outR[i] = lo[1];
+	}
+	outL[numBands - 1] = x[0];
+	outR[numBands - 1] = x[1];
+}
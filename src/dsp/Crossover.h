@@ -0,0 +1,81 @@
+// Copyright 2025 tilr
+// Linkwitz-Riley 24dB/oct crossover, splits a stereo signal into 2 to 4 bands
+// Each split runs its lowpass and highpass sides for left and right as four lanes of a SIMD biquad cascade
+// The allpasses run left and right as lanes of one loop
+// Lower bands go through allpasses matching the later splits, the bands sum back with a flat response
+#pragma once
+
+#include <JuceHeader.h>
+
+class Crossover
+{
+public:
+	static constexpr int kMaxBands = 4;
+
+	Crossover() {};
+	~Crossover() {};
+
+	void prepare(double srate);
+	// freqs holds numBands - 1 split frequencies, sorted here, coefficients are only updated when they change
+	void setup(int numBands, const double* freqs);
+	void clear();
+	void process(double left, double right, double* outL, double* outR); // outL and outR hold numBands samples
+	int getNumBands() const { return numBands; }
+
+private:
+#if JUCE_USE_SIMD
+	using Vec = juce::dsp::SIMDRegister<double>;
+	static constexpr int kWidth = (int)Vec::SIMDNumElements;
+#else
+	using Vec = double;
+	static constexpr int kWidth = 1;
+#endif
+	static constexpr int kSplitLanes = 4; // lowpass left, lowpass right, highpass left, highpass right
+	static constexpr int kGroups = (kSplitLanes + kWidth - 1) / kWidth;
+
+	struct Biquad {
+		double b0 = 1.0, b1 = 0.0, b2 = 0.0, a1 = 0.0, a2 = 0.0;
+		double z1[2] = {};
+		double z2[2] = {};
+
+		void lp(double srate, double freq);
+		void hp(double srate, double freq);
+		void ap(double srate, double freq);
+		void clear();
+		void process(double* x) // both lanes in place
+		{
+			for (int lane = 0; lane < 2; ++lane) {
+				double y = b0 * x[lane] + z1[lane];
+				z1[lane] = b1 * x[lane] - a1 * y + z2[lane];
+				z2[lane] = b2 * x[lane] - a2 * y;
+				x[lane] = y;
+			}
+		}
+	};
+
+	// transposed direct form 2 biquad over kWidth lanes, same recursion as Biquad
+	struct Stage {
+		Vec b0 {}, b1 {}, b2 {}, a1 {}, a2 {};
+		Vec z1 {}, z2 {};
+		Vec process(Vec x) {
+			Vec y = b0 * x + z1;
+			z1 = b1 * x - a1 * y + z2;
+			z2 = b2 * x - a2 * y;
+			return y;
+		}
+	};
+
+	struct Split {
+		double freq = -1.0;
+		Stage sections[2][kGroups]; // two butterworth sections make each LR4 side
+	};
+
+	static void setLane(Vec& v, int lane, double value);
+	static void setCoeffs(Split& split, const Biquad& lp, const Biquad& hp);
+	void updateCoeffs();
+
+	double srate = 44100.0;
+	int numBands = 2;
+	Split splits[kMaxBands - 1];
+	Biquad allpass[kMaxBands - 1][kMaxBands - 1]; // [band][split], phase compensation of lower bands
+};
@@ -0,0 +1,157 @@
+#include "FilterBank.h"
+
+FilterBank::FilterBank()
+{
+	for (int lane = 0; lane < kGroups * kWidth; ++lane) {
+		setCoeffs(&Group::lowcut, lane, nullptr);
+		setCoeffs(&Group::highcut, lane, nullptr);
+	}
+}
+
+void FilterBank::prepare(double srate_, int maxSamples)
+{
+	if (srate != srate_) {
+		for (auto& band : bands) {
+			band.lowcut = -1.0; // force coefficients update
+			band.highcut = -1.0;
+		}
+	}
+	srate = srate_;
+	for (auto& band : bands) {
+		band.outL.resize(maxSamples, 0.0);
+		band.outR.resize(maxSamples, 0.0);
+	}
+	clear();
+}
+
+void FilterBank::clear()
+{
+	for (int lane = 0; lane < kGroups * kWidth; ++lane)
+		clearLane(lane);
+	for (auto& band : bands) {
+		band.active = false;
+		band.wasActive = false;
+	}
+}
+
+void FilterBank::setLane(Vec& v, int lane, double value)
+{
+#if JUCE_USE_SIMD
+	v.set((size_t)lane, value);
+#else
+	(void)lane;
+	v = value;
+#endif
+}
+
+void FilterBank::setCoeffs(Stage Group::* stage, int lane, const RBJ* rbj)
+{
+	double b0 = 1.0, b1 = 0.0, b2 = 0.0, a1 = 0.0, a2 = 0.0;
+	if (rbj != nullptr)
+		rbj->getCoeffs(b0, b1, b2, a1, a2);
+
+	auto& s = groups[lane / kWidth].*stage;
+	int idx = lane % kWidth;
+	setLane(s.b0, idx, b0);
+	setLane(s.b1, idx, b1);
+	setLane(s.b2, idx, b2);
+	setLane(s.a1, idx, a1);
+	setLane(s.a2, idx, a2);
+}
+
+void FilterBank::clearLane(int lane)
+{
+	auto& group = groups[lane / kWidth];
+	int idx = lane % kWidth;
+	for (auto* s : { &group.lowcut, &group.highcut }) {
+		setLane(s->x1, idx, 0.0);
+		setLane(s->x2, idx, 0.0);
+		setLane(s->y1, idx, 0.0);
+		setLane(s->y2, idx, 0.0);
+	}
+}
+
+int FilterBank::request(int id, int input, double lowcut, double highcut)
+{
+	for (int i = 0; i < id; ++i) {
+		auto& band = bands[i];
+		if (band.active && band.input == input && band.lowcut == lowcut && band.highcut == highcut)
+			return i;
+	}
+
+	auto& band = bands[id];
+	if (band.lowcut != lowcut) {
+		RBJ rbj;
+		if (lowcut > 0.0) rbj.hp(srate, lowcut, 0.707);
+		setCoeffs(&Group::lowcut, id * 2, lowcut > 0.0 ? &rbj : nullptr);
+		setCoeffs(&Group::lowcut, id * 2 + 1, lowcut > 0.0 ? &rbj : nullptr);
+	}
+	if (band.highcut != highcut) {
+		RBJ rbj;
+		if (highcut > 0.0) rbj.lp(srate, highcut, 0.707);
+		setCoeffs(&Group::highcut, id * 2, highcut > 0.0 ? &rbj : nullptr);
+		setCoeffs(&Group::highcut, id * 2 + 1, highcut > 0.0 ? &rbj : nullptr);
+	}
+	band.input = input;
+	band.lowcut = lowcut;
+	band.highcut = highcut;
+	band.active = true;
+	return id;
+}
+
+void FilterBank::process(const double* mainL, const double* mainR, const double* sideL, const double* sideR, int numSamples)
+{
+	const double* laneIn[kGroups * kWidth] = {};
+	double* laneOut[kGroups * kWidth] = {};
+
+	for (int id = 0; id < kNumBands; ++id) {
+		auto& band = bands[id];
+		if (!band.active) {
+			band.wasActive = false;
+			continue;
+		}
+
+		if (!band.wasActive) {
+			clearLane(id * 2);
+			clearLane(id * 2 + 1);
+		}
+
+		if ((int)band.outL.size() < numSamples) {
+			band.outL.resize(numSamples, 0.0);
+			band.outR.resize(numSamples, 0.0);
+		}
+
+		laneIn[id * 2] = band.input == Input::Side ? sideL : mainL;
+		laneIn[id * 2 + 1] = band.input == Input::Side ? sideR : mainR;
+		laneOut[id * 2] = band.outL.data();
+		laneOut[id * 2 + 1] = band.outR.data();
+		band.wasActive = true;
+		band.active = false;
+	}
+
+	// lanes of a group run in lockstep, idle lanes are fed silence
+	for (int g = 0; g < kGroups; ++g) {
+		bool any = false;
+		for (int k = 0; k < kWidth; ++k)
+			any = any || laneIn[g * kWidth + k] != nullptr;
+		if (!any)
+			continue;
+
+		auto& group = groups[g];
+		const double** in = laneIn + g * kWidth;
+		double** out = laneOut + g * kWidth;
+		alignas(32) double x[kWidth];
+		for (int i = 0; i < numSamples; ++i) {
+			for (int k = 0; k < kWidth; ++k)
+				x[k] = in[k] != nullptr ? in[k][i] : 0.0;
+#if JUCE_USE_SIMD
+			auto v = group.highcut.process(group.lowcut.process(Vec::fromRawArray(x)));
+			v.copyToRawArray(x);
+#else
+			x[0] = group.highcut.process(group.lowcut.process(x[0]));
+#endif
+			for (int k = 0; k < kWidth; ++k)
+				if (out[k] != nullptr) out[k][i] = x[k];
+		}
+	}
+}
@@ -0,0 +1,86 @@
+// Copyright 2025 tilr
+// Band limiting front end shared by the envelope followers and the audio trigger detector
+// Each requester owns a band, bands with the same input and cutoffs are processed once and shared
+// Every band channel is a lane of a SIMD biquad cascade (lowcut then highcut), bypassed filters run identity coefficients
+#pragma once
+
+#include <JuceHeader.h>
+#include <vector>
+#include "filter/RBJ.h"
+
+class FilterBank
+{
+public:
+	enum Input {
+		Main,
+		Side
+	};
+
+	enum BandId {
+		Transient,
+		CutEnv,
+		ResEnv,
+		kNumBands
+	};
+
+	FilterBank();
+	~FilterBank() {};
+
+	void prepare(double srate, int maxSamples);
+	void clear();
+	// requests a band for this block, a cutoff <= 0 bypasses that filter
+	// returns the band holding the output, which is an earlier band when input and cutoffs match
+	int request(int band, int input, double lowcut, double highcut);
+	void process(const double* mainL, const double* mainR, const double* sideL, const double* sideR, int numSamples);
+
+	const double* getLeft(int band) const { return bands[band].outL.data(); }
+	const double* getRight(int band) const { return bands[band].outR.data(); }
+
+private:
+#if JUCE_USE_SIMD
+	using Vec = juce::dsp::SIMDRegister<double>;
+	static constexpr int kWidth = (int)Vec::SIMDNumElements;
+#else
+	using Vec = double;
+	static constexpr int kWidth = 1;
+#endif
+	static constexpr int kLanes = kNumBands * 2; // band * 2 + channel
+	static constexpr int kGroups = (kLanes + kWidth - 1) / kWidth;
+
+	// direct form 1 biquad over kWidth lanes, same recursion as RBJ::df1
+	struct Stage {
+		Vec b0 {}, b1 {}, b2 {}, a1 {}, a2 {};
+		Vec x1 {}, x2 {}, y1 {}, y2 {};
+		Vec process(Vec x) {
+			Vec y = b0 * x + b1 * x1 + b2 * x2 - a1 * y1 - a2 * y2;
+			x2 = x1;
+			x1 = x;
+			y2 = y1;
+			y1 = y;
+			return y;
+		}
+	};
+
+	struct Group {
+		Stage lowcut;
+		Stage highcut;
+	};
+
+	struct Band {
+		int input = Input::Main;
+		double lowcut = -1.0;
+		double highcut = -1.0;
+		bool active = false; // requested on this block
+		bool wasActive = false; // processed on the last block, otherwise its state is stale
+		std::vector<double> outL;
+		std::vector<double> outR;
+	};
+
+	static void setLane(Vec& v, int lane, double value);
+	void setCoeffs(Stage Group::* stage, int lane, const RBJ* rbj); // nullptr sets identity coefficients
+	void clearLane(int lane);
+
+	Band bands[kNumBands];
+	Group groups[kGroups];
+	double srate = 44100.0;
+};
@@ -3,7 +3,6 @@
 #pragma once
 #include "JuceHeader.h"
 #include "../Globals.h"
-#include "filter/RBJ.h"
 
 using namespace globals;
 
@@ -14,17 +13,15 @@ public:
 	~Follower() {};
 
 	void prepare(double srate, double thresh_, bool autorel_, double attack_, double hold, double release, double lowcutfreq, double highcutfreq);
-	double process(double lsamp, double rsamp);
+	// processes a block of band limited samples from FilterBank into envelope values
+	void process(const double* lsamps, const double* rsamps, double* out, int numSamples);
 	void clear();
+	bool isIdle(double threshold) const;
 
-	double outl = 0.0;
-	double outr = 0.0;
+	double lowcut = 20.0; // band limiting cutoffs applied by FilterBank
+	double highcut = 20000.0;
 
 private:
-	RBJ lowcutL;
-	RBJ highcutL;
-	RBJ lowcutR;
-	RBJ highcutR;
 	int rmswindow = 100;
 	double thresh = 0.0;
 	bool autorel = false;
@@ -0,0 +1,171 @@
+#include "Metering.h"
+
+Metering::Metering()
+{
+	for (auto& state : states)
+		state.bins.resize(LOUDNESS_BINS, 0.0);
+}
+
+void Metering::prepare(double srate_)
+{
+	srate.store(srate_);
+	resetPending.store(true);
+}
+
+void Metering::setEnabled(bool on)
+{
+	if (on) {
+		for (auto& ring : rings)
+			if (ring.buffer.getNumSamples() == 0)
+				ring.buffer.setSize(2, METER_BUFFER_SIZE);
+		resetPending.store(true);
+	}
+	enabled.store(on); // published after the rings are allocated
+}
+
+void Metering::reset(double sampleRate)
+{
+	// 4x windowed sinc interpolator, each phase is normalized to unity gain
+	// phase p estimates the signal p/4 samples after the middle of the history
+	for (int p = 0; p < TP_PHASES; ++p) {
+		double sum = 0.0;
+		for (int k = 0; k < TP_TAPS; ++k) {
+			double d = TP_TAPS / 2 - 1 + (double)p / TP_PHASES - k;
+			double sinc = d == 0.0 ? 1.0 : std::sin(MathConstants<double>::pi * d) / (MathConstants<double>::pi * d);
+			double window = 0.5 * (1.0 + std::cos(MathConstants<double>::pi * d / (TP_TAPS / 2)));
+			tpCoeffs[p][k] = (float)(sinc * window);
+			sum += sinc * window;
+		}
+		for (int k = 0; k < TP_TAPS; ++k)
+			tpCoeffs[p][k] = (float)(tpCoeffs[p][k] / sum);
+	}
+
+	// K-weighting filters from ITU-R BS.1770, recalculated for the sample rate
+	Biquad shelf;
+	{
+		double f0 = 1681.974450955533;
+		double G = 3.999843853973347;
+		double Q = 0.7071752369554196;
+		double K = std::tan(MathConstants<double>::pi * f0 / sampleRate);
+		double Vh = std::pow(10.0, G / 20.0);
+		double Vb = std::pow(Vh, 0.4996667741545416);
+		double a0 = 1.0 + K / Q + K * K;
+		shelf.b0 = (Vh + Vb * K / Q + K * K) / a0;
+		shelf.b1 = 2.0 * (K * K - Vh) / a0;
+		shelf.b2 = (Vh - Vb * K / Q + K * K) / a0;
+		shelf.a1 = 2.0 * (K * K - 1.0) / a0;
+		shelf.a2 = (1.0 - K / Q + K * K) / a0;
+	}
+	Biquad highpass;
+	{
+		double f0 = 38.13547087602444;
+		double Q = 0.5003270373238773;
+		double K = std::tan(MathConstants<double>::pi * f0 / sampleRate);
+		double a0 = 1.0 + K / Q + K * K;
+		highpass.b0 = 1.0;
+		highpass.b1 = -2.0;
+		highpass.b2 = 1.0;
+		highpass.a1 = 2.0 * (K * K - 1.0) / a0;
+		highpass.a2 = (1.0 - K / Q + K * K) / a0;
+	}
+
+	rmsCoeff = 1.0 - std::exp(-1.0 / (0.3 * sampleRate));
+	releaseCoeff = std::exp(-1.0 / (0.5 * sampleRate));
+	binSize = std::max(1, (int)(sampleRate * 0.1));
+
+	for (int stage = 0; stage < kNumStages; ++stage) {
+		auto& state = states[stage];
+		for (int channel = 0; channel < 2; ++channel) {
+			state.shelf[channel] = shelf;
+			state.highpass[channel] = highpass;
+			std::fill(std::begin(state.history[channel]), std::end(state.history[channel]), 0.f);
+			state.meanSquare[channel] = 0.0;
+		}
+		state.binSum = 0.0;
+		state.binCount = 0;
+		std::fill(state.bins.begin(), state.bins.end(), 0.0);
+		state.binPos = 0;
+		readouts[stage] = Readout();
+	}
+}
+
+void Metering::update()
+{
+	bool resetting = resetPending.exchange(false);
+	if (resetting)
+		reset(srate.load());
+
+	for (int stage = 0; stage < kNumStages; ++stage) {
+		auto& ring = rings[stage];
+		int ready = ring.fifo.getNumReady();
+		if (ready == 0)
+			continue;
+
+		const auto scope = ring.fifo.read(ready);
+		if (resetting)
+			continue; // samples from before the reset are discarded
+
+		process(stage, ring.buffer.getReadPointer(0, scope.startIndex1), ring.buffer.getReadPointer(1, scope.startIndex1), scope.blockSize1);
+		if (scope.blockSize2 > 0)
+			process(stage, ring.buffer.getReadPointer(0, scope.startIndex2), ring.buffer.getReadPointer(1, scope.startIndex2), scope.blockSize2);
+	}
+}
+
+void Metering::process(int stage, const float* left, const float* right, int numSamples)
+{
+	auto& state = states[stage];
+	auto& readout = readouts[stage];
+
+	for (int channel = 0; channel < 2; ++channel) {
+		auto* src = channel == 0 ? left : right;
+		auto* history = state.history[channel];
+		auto& shelf = state.shelf[channel];
+		auto& highpass = state.highpass[channel];
+		double peak = readout.peak[channel];
+		double truePeak = readout.truePeak[channel];
+		double meanSquare = state.meanSquare[channel];
+
+		for (int i = 0; i < numSamples; ++i) {
+			float x = src[i];
+			std::memmove(history, history + 1, sizeof(float) * (TP_TAPS - 1));
+			history[TP_TAPS - 1] = x;
+
+			double ax = std::abs((double)x);
+			peak = std::max(ax, peak * releaseCoeff);
+
+			double inter = 0.0;
+			for (int p = 0; p < TP_PHASES; ++p) {
+				float y = 0.f;
+				for (int k = 0; k < TP_TAPS; ++k)
+					y += tpCoeffs[p][k] * history[k];
+				inter = std::max(inter, (double)std::abs(y));
+			}
+			truePeak = std::max(inter, truePeak * releaseCoeff);
+
+			meanSquare += rmsCoeff * (ax * ax - meanSquare);
+
+			double k = highpass.eval(shelf.eval((double)x));
+			state.binSum += k * k;
+		}
+
+		readout.peak[channel] = (float)peak;
+		readout.truePeak[channel] = (float)truePeak;
+		readout.rms[channel] = (float)std::sqrt(meanSquare);
+		state.meanSquare[channel] = meanSquare;
+	}
+
+	// loudness bins hold the K-weighted power summed over both channels
+	state.binCount += numSamples;
+	while (state.binCount >= binSize) {
+		state.bins[state.binPos] = state.binSum * binSize / state.binCount; // leftover samples are carried into the next bin
+		state.binSum -= state.bins[state.binPos];
+		state.binCount -= binSize;
+		state.binPos = (state.binPos + 1) % LOUDNESS_BINS;
+
+		double sum = 0.0;
+		for (auto bin : state.bins)
+			sum += bin;
+		double power = sum / ((double)binSize * LOUDNESS_BINS);
+		readout.loudness = power > 1e-10 ? (float)(-0.691 + 10.0 * std::log10(power)) : -100.f;
+	}
+}
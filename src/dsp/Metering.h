@@ -0,0 +1,110 @@
+// Copyright 2025 tilr
+// Input, wet and output level metering
+// The audio thread copies each block into a lock-free ring per stage, the consumer (UI timer)
+// drains the rings and computes peak, true-peak, RMS and short-term loudness off the audio thread
+#pragma once
+
+#include <JuceHeader.h>
+#include <atomic>
+#include <vector>
+
+class Metering
+{
+public:
+	enum Stage {
+		Input, // dry input, before the filters and gain
+		Wet, // filtered signal after gain, before the dry/wet mix
+		Output, // plugin output, after gain and mix
+		kNumStages
+	};
+
+	struct Readout {
+		float peak[2] = {}; // sample peak with release, linear gain
+		float truePeak[2] = {}; // 4x interpolated peak with release, linear gain
+		float rms[2] = {}; // 300ms RMS, linear gain
+		float loudness = -100.f; // short-term loudness over 3s, LUFS
+	};
+
+	Metering();
+	~Metering() {};
+
+	void prepare(double srate); // any thread, the consumer resets its state on the next update
+
+	// audio thread, drops the block when the ring is full (nobody is consuming)
+	template <typename FloatType>
+	void push(int stage, const FloatType* left, const FloatType* right, int numSamples)
+	{
+		if (!enabled.load())
+			return;
+
+		auto& ring = rings[stage];
+		if (ring.fifo.getFreeSpace() < numSamples)
+			return;
+
+		const auto scope = ring.fifo.write(numSamples);
+		for (int channel = 0; channel < 2; ++channel) {
+			auto* src = channel == 0 ? left : right;
+			auto* dst = ring.buffer.getWritePointer(channel);
+			for (int i = 0; i < scope.blockSize1; ++i)
+				dst[scope.startIndex1 + i] = src == nullptr ? 0.f : (float)src[i];
+			for (int i = 0; i < scope.blockSize2; ++i)
+				dst[scope.startIndex2 + i] = src == nullptr ? 0.f : (float)src[scope.blockSize1 + i];
+		}
+	}
+
+	void update(); // consumer thread, drains the rings into the readouts
+	Readout getReadout(int stage) const { return readouts[stage]; } // consumer thread
+
+	// consumer thread, set while a meter is showing, the audio thread skips pushes otherwise
+	// the rings are allocated on the first enable and samples left from a previous session are dropped
+	void setEnabled(bool on);
+	bool isEnabled() const { return enabled.load(); } // audio thread, skips gathering stage blocks nobody reads
+
+private:
+	static constexpr int METER_BUFFER_SIZE = 32768; // about half a second at 48kHz, the consumer drains every frame
+	static constexpr int TP_TAPS = 8; // taps per phase of the true-peak interpolator
+	static constexpr int TP_PHASES = 4;
+	static constexpr int LOUDNESS_BINS = 30; // 100ms bins over the 3s short-term window
+
+	struct Biquad {
+		double b0 = 1.0, b1 = 0.0, b2 = 0.0, a1 = 0.0, a2 = 0.0;
+		double z1 = 0.0, z2 = 0.0;
+		double eval(double x) {
+			double y = b0 * x + z1;
+			z1 = b1 * x - a1 * y + z2;
+			z2 = b2 * x - a2 * y;
+			return y;
+		}
+	};
+
+	struct Ring {
+		AbstractFifo fifo { METER_BUFFER_SIZE };
+		AudioBuffer<float> buffer; // allocated by setEnabled before the first push
+	};
+
+	struct StageState {
+		Biquad shelf[2]; // K-weighting pre-filter
+		Biquad highpass[2]; // K-weighting RLB filter
+		float history[2][TP_TAPS] = {}; // last input samples of the true-peak interpolator
+		double meanSquare[2] = {};
+		double binSum = 0.0; // K-weighted power of the current loudness bin
+		int binCount = 0;
+		std::vector<double> bins; // K-weighted power of the last LOUDNESS_BINS bins
+		int binPos = 0;
+	};
+
+	void reset(double sampleRate);
+	void process(int stage, const float* left, const float* right, int numSamples);
+
+	std::atomic<double> srate = 44100.0;
+	std::atomic<bool> resetPending = true;
+	std::atomic<bool> enabled = false;
+
+	Ring rings[kNumStages];
+	StageState states[kNumStages];
+	Readout readouts[kNumStages];
+	float tpCoeffs[TP_PHASES][TP_TAPS] = {};
+	double rmsCoeff = 0.0;
+	double releaseCoeff = 0.0; // per sample peak release
+	int binSize = 4410;
+};
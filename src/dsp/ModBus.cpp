@@ -0,0 +1,131 @@
+#include "ModBus.h"
+
+const char* ModBus::getSourceName(int src)
+{
+	static const char* names[kNumSources] = { "Cut pattern", "Res pattern", "Cut env", "Res env", "Velocity" };
+	return src >= 0 && src < kNumSources ? names[src] : "";
+}
+
+const char* ModBus::getDestName(int dst)
+{
+	static const char* names[kNumDests] = { "Cutoff", "Resonance", "Drive", "Morph", "Mix" };
+	return dst >= 0 && dst < kNumDests ? names[dst] : "";
+}
+
+bool ModBus::isBuiltin(int src, int dst)
+{
+	return (src == PatCut && dst == Cutoff)
+		|| (src == PatRes && dst == Res)
+		|| (src == EnvCut && dst == Cutoff)
+		|| (src == EnvRes && dst == Res);
+}
+
+void ModBus::prepare(int maxSamples)
+{
+	for (auto& buf : sources)
+		buf.assign(maxSamples, 0.0);
+	for (auto& buf : dests)
+		buf.assign(maxSamples, 0.0);
+}
+
+void ModBus::ensureSize(int numSamples)
+{
+	if ((int)sources[0].size() < numSamples)
+		prepare(numSamples);
+}
+
+void ModBus::update()
+{
+	// the copy is kept only when no publish overlapped it, otherwise the previous block routing is reused
+	auto version = routesVersion.load(std::memory_order_acquire);
+	if (version & 1)
+		return;
+
+	Matrix copy;
+	for (int src = 0; src < kNumSources; ++src)
+		for (int dst = 0; dst < kNumDests; ++dst)
+			copy[src][dst] = routes[src][dst].load(std::memory_order_relaxed);
+
+	std::atomic_thread_fence(std::memory_order_acquire);
+	if (routesVersion.load(std::memory_order_relaxed) != version)
+		return;
+
+	std::memcpy(matrix, copy, sizeof(Matrix));
+}
+
+void ModBus::publish(const Matrix& m)
+{
+	routesVersion.fetch_add(1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+	for (int src = 0; src < kNumSources; ++src)
+		for (int dst = 0; dst < kNumDests; ++dst)
+			routes[src][dst].store(m[src][dst], std::memory_order_relaxed);
+	routesVersion.fetch_add(1, std::memory_order_release);
+}
+
+void ModBus::setDepth(int src, int dst, double depth)
+{
+	Matrix m;
+	for (int s = 0; s < kNumSources; ++s)
+		for (int d = 0; d < kNumDests; ++d)
+			m[s][d] = getDepth(s, d);
+	m[src][dst] = depth;
+	publish(m);
+}
+
+void ModBus::render(Dest dst, double base, int numSamples)
+{
+	auto* dest = dests[dst].data();
+	FloatVectorOperations::fill(dest, base, numSamples);
+	for (int src = 0; src < kNumSources; ++src) {
+		if (matrix[src][dst] != 0.0 && !isBuiltin(src, dst))
+			FloatVectorOperations::addWithMultiply(dest, sources[src].data(), matrix[src][dst], numSamples);
+	}
+}
+
+void ModBus::add(Dest dst, Source src, double depth, int numSamples)
+{
+	FloatVectorOperations::addWithMultiply(dests[dst].data(), sources[src].data(), depth, numSamples);
+}
+
+void ModBus::clip(Dest dst, int numSamples)
+{
+	auto* dest = dests[dst].data();
+	FloatVectorOperations::clip(dest, dest, 0.0, 1.0, numSamples);
+}
+
+bool ModBus::isModulated(Dest dst) const
+{
+	for (int src = 0; src < kNumSources; ++src) {
+		if (matrix[src][dst] != 0.0 && !isBuiltin(src, dst))
+			return true;
+	}
+	return false;
+}
+
+void ModBus::clearMatrix()
+{
+	Matrix m = {};
+	publish(m);
+}
+
+String ModBus::serialize() const
+{
+	String str;
+	for (int src = 0; src < kNumSources; ++src)
+		for (int dst = 0; dst < kNumDests; ++dst)
+			str << getDepth(src, dst) << " ";
+	return str;
+}
+
+void ModBus::deserialize(const String& str)
+{
+	// parsed in full before publishing, the audio thread never sees a half restored routing
+	Matrix m = {};
+	auto tokens = StringArray::fromTokens(str, " ", "");
+	tokens.removeEmptyStrings();
+	for (int i = 0; i < tokens.size() && i < kNumSources * kNumDests; ++i) {
+		m[i / kNumDests][i % kNumDests] = tokens[i].getDoubleValue();
+	}
+	publish(m);
+}
@@ -0,0 +1,71 @@
+// Copyright 2025 tilr
+// Modulation bus, renders modulation sources into per block buffers
+// and routes them into destination buffers through a depth matrix
+// The matrix is edited on the message thread and published as a whole, the audio thread
+// takes a consistent copy at the start of each block so it never renders a partly written routing
+#pragma once
+
+#include <JuceHeader.h>
+#include <atomic>
+#include <vector>
+
+class ModBus
+{
+public:
+	enum Source {
+		PatCut, // cutoff pattern, inverted so 1 is the top of the view
+		PatRes, // resonance pattern
+		EnvCut, // cutoff envelope follower
+		EnvRes, // resonance envelope follower
+		Velocity, // last MIDI note velocity
+		kNumSources
+	};
+
+	enum Dest {
+		Cutoff,
+		Res,
+		Drive,
+		Morph,
+		Mix,
+		kNumDests
+	};
+
+	static constexpr int kNumDepths = 5;
+	static constexpr double kDepths[kNumDepths] = { 0.0, 0.5, 1.0, -0.5, -1.0 };
+
+	ModBus() {};
+	~ModBus() {};
+
+	static const char* getSourceName(int src);
+	static const char* getDestName(int dst);
+	static bool isBuiltin(int src, int dst); // routes driven by the main params, not editable in the matrix
+
+	void prepare(int maxSamples);
+	void ensureSize(int numSamples);
+	double* getSource(Source src) { return sources[src].data(); }
+	double* getDest(Dest dst) { return dests[dst].data(); }
+
+	void update(); // audio thread, block start, copies the last fully published matrix
+	void render(Dest dst, double base, int numSamples); // fills dst with base plus every user route
+	void add(Dest dst, Source src, double depth, int numSamples); // adds a source scaled by depth into dst
+	void clip(Dest dst, int numSamples); // limits dst to 0..1
+	bool isModulated(Dest dst) const; // dst has at least one user route
+
+	// message thread
+	double getDepth(int src, int dst) const { return routes[src][dst].load(std::memory_order_relaxed); }
+	void setDepth(int src, int dst, double depth);
+	void clearMatrix();
+	String serialize() const;
+	void deserialize(const String& str);
+
+private:
+	using Matrix = double[kNumSources][kNumDests];
+
+	void publish(const Matrix& m);
+
+	std::atomic<double> routes[kNumSources][kNumDests] {}; // user routes depth, published by the message thread
+	std::atomic<uint32_t> routesVersion = 0; // odd while a publish is writing the routes
+	double matrix[kNumSources][kNumDests] = {}; // audio thread copy of the routes used by the current block
+	std::vector<double> sources[kNumSources];
+	std::vector<double> dests[kNumDests];
+};
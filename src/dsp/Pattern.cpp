@@ -10,6 +10,7 @@
 #include "Pattern.h"
 #include <cmath>
 #include <algorithm>
+#include <array>
 #include "../PluginProcessor.h"
 
 std::vector<PPoint> Pattern::copy_pattern;
@@ -22,13 +23,22 @@ Pattern::Pattern(int i)
 
 void Pattern::incrementVersion()
 {
-    versionID = versionIDCounter;
-    versionIDCounter += 1;
+    versionID = versionIDCounter.fetch_add(1, std::memory_order_relaxed);
+}
+
+uint64_t Pattern::newPointID()
+{
+    return pointsIDCounter.fetch_add(1, std::memory_order_relaxed);
+}
+
+uint64_t Pattern::newPointIDs(size_t count)
+{
+    return pointsIDCounter.fetch_add(count, std::memory_order_relaxed);
 }
 
 void Pattern::sortPoints()
 {
-    std::sort(points.begin(), points.end(), [](const PPoint& a, const PPoint& b) {
+    std::stable_sort(points.begin(), points.end(), [](const PPoint& a, const PPoint& b) {
         return a.x < b.x;
     });
 }
@@ -46,39 +56,50 @@ void Pattern::setTension(double t, double tatk, double trel, bool dual)
     tensionAtk.store(tatk);
     tensionRel.store(trel);
     tensionMult.store(t);
+    segmentsID.store(versionIDCounter.fetch_add(1, std::memory_order_relaxed)); // tension is applied when reading Y
 }
 
 int Pattern::insertPoint(double x, double y, double tension, int type, bool sort)
 {
     std::lock_guard<std::mutex> lock(pointsmtx);
-    auto id = pointsIDCounter;
-    pointsIDCounter += 1;
+    return insertPointUnsafe(x, y, tension, type, sort);
+};
 
-    const PPoint p = { id, x, y, tension, type };
-    points.push_back(p);
-    if (sort)
-        sortPoints();
+int Pattern::insertPointUnsafe(double x, double y, double tension, int type, bool sort)
+{
+    const PPoint p = { newPointID(), x, y, tension, type };
     clearTransform();
 
-    // return point index
-    auto pidx = std::find_if(points.begin(), points.end(), [id](const PPoint& p) { return p.id == id; });
-    return pidx == points.end() ? -1 : (int)std::distance(points.begin(), pidx);
+    if (!sort) {
+        points.push_back(p);
+        return (int)points.size() - 1;
+    }
+
+    // points are kept sorted, binary search the insert position instead of sorting again
+    auto it = std::upper_bound(points.begin(), points.end(), x, [](double x, const PPoint& a) { return x < a.x; });
+    it = points.insert(it, p);
+    return (int)std::distance(points.begin(), it);
 };
 
-int Pattern::insertPointUnsafe(double x, double y, double tension, int type, bool sort)
+void Pattern::insertPoints(const std::vector<PPoint>& pts)
 {
-    auto id = pointsIDCounter;
-    pointsIDCounter += 1;
+    std::lock_guard<std::mutex> lock(pointsmtx);
+    insertPointsUnsafe(pts);
+}
 
-    const PPoint p = { id, x, y, tension, type };
-    points.push_back(p);
-    if (sort)
-        sortPoints();
+void Pattern::insertPointsUnsafe(const std::vector<PPoint>& pts)
+{
+    auto cmp = [](const PPoint& a, const PPoint& b) { return a.x < b.x; };
     clearTransform();
 
-    auto pidx = std::find_if(points.begin(), points.end(), [id](const PPoint& p) { return p.id == id; });
-    return pidx == points.end() ? -1 : (int)std::distance(points.begin(), pidx);
-};
+    auto mid = points.insert(points.end(), pts.begin(), pts.end());
+    auto id = newPointIDs(pts.size());
+    for (auto it = mid; it != points.end(); ++it)
+        it->id = id++;
+
+    std::stable_sort(mid, points.end(), cmp);
+    std::inplace_merge(points.begin(), mid, points.end(), cmp);
+}
 
 void Pattern::removePoint(double x, double y)
 {
@@ -101,19 +122,15 @@ void Pattern::removePoint(int i) {
 void Pattern::removePointsInRange(double x1, double x2)
 {
     std::lock_guard<std::mutex> lock(pointsmtx);
-    clearTransform();
-    removePointsInRangeAux(x1, x2);
+    removePointsInRangeUnsafe(x1, x2);
 }
 
-void Pattern::removePointsInRangeAux(double x1, double x2)
+void Pattern::removePointsInRangeUnsafe(double x1, double x2)
 {
-    for (auto i = points.begin(); i != points.end(); ++i) {
-        if (i->x >= x1 && i->x <= x2) {
-            i = points.erase(i);
-            removePointsInRangeAux(x1, x2);
-            return;
-        }
-    }
+    clearTransform();
+    auto first = std::lower_bound(points.begin(), points.end(), x1, [](const PPoint& a, double x) { return a.x < x; });
+    auto last = std::upper_bound(first, points.end(), x2, [](double x, const PPoint& a) { return x < a.x; });
+    points.erase(first, last);
 }
 
 void Pattern::invert()
@@ -154,9 +171,13 @@ void Pattern::doublePattern()
     std::lock_guard<std::mutex> lock(pointsmtx);
     clearTransform();
 
-    auto pts = points;
-    for (auto& p : pts) {
-        insertPointUnsafe(p.x + 1.0, p.y, p.tension, p.type, false);
+    auto size = points.size();
+    points.reserve(size * 2);
+    for (size_t i = 0; i < size; ++i) {
+        auto p = points[i];
+        p.id = newPointID();
+        p.x += 1.0;
+        points.push_back(p);
     }
 
     for (auto& p : points) {
@@ -178,7 +199,11 @@ void Pattern::rotate(double x) {
         if (p->x < 0.0) p->x += 1.0;
         if (p->x > 1.0) p->x -= 1.0;
     }
-    sortPoints();
+    // sorted points stay sorted in two runs split by the wrap point, rotate them back in place
+    auto cmp = [](const PPoint& a, const PPoint& b) { return a.x < b.x; };
+    std::rotate(points.begin(), std::is_sorted_until(points.begin(), points.end(), cmp), points.end());
+    if (!std::is_sorted(points.begin(), points.end(), cmp))
+        sortPoints();
     incrementVersion();
 }
 
@@ -193,7 +218,11 @@ void Pattern::rotateUnsafe(double x) {
         if (p->x < 0.0) p->x += 1.0;
         if (p->x > 1.0) p->x -= 1.0;
     }
-    sortPoints();
+    // sorted points stay sorted in two runs split by the wrap point, rotate them back in place
+    auto cmp = [](const PPoint& a, const PPoint& b) { return a.x < b.x; };
+    std::rotate(points.begin(), std::is_sorted_until(points.begin(), points.end(), cmp), points.end());
+    if (!std::is_sorted(points.begin(), points.end(), cmp))
+        sortPoints();
     incrementVersion();
 }
 
@@ -244,6 +273,123 @@ void Pattern::buildSegments()
         auto p2 = pts[i + 1];
         segments.push_back({p1.x, p2.x, p1.y, p2.y, p1.tension, 0, p1.type});
     }
+    segmentsID.store(versionIDCounter.fetch_add(1, std::memory_order_relaxed));
+}
+
+/*
+    Incremental version of buildSegments for drags that move a few points
+    Point i starts segment i+1 and ends segment i, the first and last points also
+    define the ghost segments at both ends, only those segments are written
+*/
+void Pattern::updateSegments(const std::vector<size_t>& changed)
+{
+    // copies of the points around each change, index -1 and n are the ghost points
+    std::vector<std::pair<size_t, std::array<PPoint, 3>>> patches;
+    PPoint first = {}, last = {};
+    size_t n = 0;
+    bool rebuild = false;
+    {
+        std::lock_guard<std::mutex> lock(pointsmtx);
+        n = points.size();
+        if (n < 2) {
+            rebuild = true;
+        }
+        else {
+            first = points.front();
+            last = points.back();
+            auto at = [&](int i) -> PPoint {
+                if (i < 0) return { 0, last.x - 1.0, last.y, last.tension, last.type };
+                if (i >= (int)n) return { 0, first.x + 1.0, first.y, first.tension, first.type };
+                return points[i];
+            };
+            patches.reserve(changed.size());
+            for (auto idx : changed) {
+                if (idx >= n
+                    || (idx > 0 && points[idx - 1].x > points[idx].x)
+                    || (idx < n - 1 && points[idx].x > points[idx + 1].x))
+                {
+                    rebuild = true;
+                    break;
+                }
+                patches.push_back({ idx, { at((int)idx - 1), points[idx], at((int)idx + 1) } });
+            }
+            if (rebuild && !std::is_sorted(points.begin(), points.end(), [](const PPoint& a, const PPoint& b) { return a.x < b.x; }))
+                sortPoints();
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        if (!rebuild && segments.size() == n + 1) {
+            auto write = [&](size_t seg, const PPoint& a, const PPoint& b) {
+                segments[seg] = { a.x, b.x, a.y, b.y, a.tension, 0, a.type };
+            };
+            for (auto& [idx, pts] : patches) {
+                write(idx, pts[0], pts[1]);
+                write(idx + 1, pts[1], pts[2]);
+            }
+            // first and last points are repeated by the ghost segments
+            write(0, { 0, last.x - 1.0, last.y, last.tension, last.type }, first);
+            write(n, last, { 0, first.x + 1.0, first.y, first.tension, first.type });
+            segmentsID.store(versionIDCounter.fetch_add(1, std::memory_order_relaxed));
+            return;
+        }
+    }
+
+    buildSegments();
+}
+
+/*
+    Range version of updateSegments for edits that replace a run of points, like a sequencer cell
+    The run may have grown or shrunk, segments first to last depend on it and are spliced
+    in place of the old ones, the rest of the segments are kept
+*/
+void Pattern::updateSegments(size_t first, size_t last)
+{
+    std::vector<Segment> patch;
+    PPoint head = {}, tail = {};
+    size_t n = 0;
+    bool rebuild = false;
+    {
+        std::lock_guard<std::mutex> lock(pointsmtx);
+        n = points.size();
+        rebuild = n < 2 || first > last || last > n
+            || !std::is_sorted(points.begin() + (first > 0 ? first - 1 : 0), points.begin() + std::min(last + 1, n),
+                [](const PPoint& a, const PPoint& b) { return a.x < b.x; });
+
+        if (!rebuild) {
+            head = points.front();
+            tail = points.back();
+            auto at = [&](int i) -> PPoint {
+                if (i < 0) return { 0, tail.x - 1.0, tail.y, tail.tension, tail.type };
+                if (i >= (int)n) return { 0, head.x + 1.0, head.y, head.tension, head.type };
+                return points[i];
+            };
+            patch.reserve(last - first + 1);
+            for (size_t seg = first; seg <= last; ++seg) {
+                auto a = at((int)seg - 1);
+                auto b = at((int)seg);
+                patch.push_back({ a.x, b.x, a.y, b.y, a.tension, 0, a.type });
+            }
+        }
+    }
+
+    if (!rebuild) {
+        std::lock_guard<std::mutex> lock(mtx);
+        // segments are always one more than the points, the difference is the change in the run length
+        auto oldLast = (ptrdiff_t)last - ((ptrdiff_t)n + 1 - (ptrdiff_t)segments.size());
+        if (oldLast >= (ptrdiff_t)first - 1 && oldLast < (ptrdiff_t)segments.size()) {
+            auto it = segments.erase(segments.begin() + first, segments.begin() + oldLast + 1);
+            segments.insert(it, patch.begin(), patch.end());
+            // first and last points are repeated by the ghost segments
+            segments.front() = { tail.x - 1.0, head.x, tail.y, head.y, tail.tension, 0, tail.type };
+            segments.back() = { tail.x, head.x + 1.0, tail.y, head.y, tail.tension, 0, tail.type };
+            segmentsID.store(versionIDCounter.fetch_add(1, std::memory_order_relaxed));
+            return;
+        }
+    }
+
+    buildSegments();
 }
 
 // Thread safely returns a copy of segments
@@ -284,14 +430,20 @@ void Pattern::loadRandom(int grid) {
 
 void Pattern::copy()
 {
+    std::lock_guard<std::mutex> lock(copymtx);
     copy_pattern = points;
 }
 
 void Pattern::paste()
 {
+    std::vector<PPoint> pts;
+    {
+        std::lock_guard<std::mutex> lock(copymtx);
+        pts = copy_pattern;
+    }
     std::lock_guard<std::mutex> lock(pointsmtx);
-    if (copy_pattern.size() > 0) {
-      points = copy_pattern;
+    if (pts.size() > 0) {
+      points = pts;
       incrementVersion();
     }
 }
@@ -350,6 +502,31 @@ double Pattern::getavgY()
     return avg;
 }
 
+uint64_t Pattern::getShapeHash()
+{
+    // FNV-1a over the points and tension, an empty pattern is the flat line at clearY
+    uint64_t hash = 14695981039346656037ull;
+    auto add = [&hash](const void* data, size_t size) {
+        auto* bytes = static_cast<const uint8_t*>(data);
+        for (size_t i = 0; i < size; ++i) {
+            hash ^= bytes[i];
+            hash *= 1099511628211ull;
+        }
+    };
+
+    std::lock_guard<std::mutex> lock(pointsmtx);
+    for (auto& p : points) {
+        add(&p.x, sizeof(p.x));
+        add(&p.y, sizeof(p.y));
+        add(&p.tension, sizeof(p.tension));
+        add(&p.type, sizeof(p.type));
+    }
+    double tension[] = { tensionMult.load(), tensionAtk.load(), tensionRel.load(), points.empty() ? clearY : 0.0 };
+    add(tension, sizeof(tension));
+    add(&dualTension, sizeof(dualTension));
+    return hash;
+}
+
 /*
   Based of https://github.com/KottV/SimpleSide/blob/main/Source/types/SSCurve.cpp
 */
@@ -527,14 +704,26 @@ double Pattern::get_y_at(double x)
     return -1;
 }
 
+void Pattern::setUndoBudget(UndoBudget* budget)
+{
+    undoStack.setBudget(budget);
+    redoStack.setBudget(budget);
+}
+
 void Pattern::createUndo()
 {
+    // later edits of the same gesture keep the state before the first one
+    if (inGesture && gestureHasUndo)
+        return;
+    gestureHasUndo = inGesture;
+
     if (undoStack.size() > globals::MAX_UNDO) {
-        undoStack.erase(undoStack.begin());
+        undoStack.dropOldest();
     }
-    undoStack.push_back(points);
+    undoStack.push(points);
     redoStack.clear();
 }
+
 void Pattern::undo()
 {
     if (undoStack.empty())
@@ -544,12 +733,12 @@ void Pattern::undo()
         std::lock_guard<std::mutex> lock(pointsmtx);
         clearTransform();
 
-        redoStack.push_back(points);
-        points = undoStack.back();
-        undoStack.pop_back();
+        redoStack.push(points);
+        points = undoStack.pop();
 
         incrementVersion();
     }
+    gestureHasUndo = false;
     buildSegments();
 }
 
@@ -561,15 +750,27 @@ void Pattern::redo()
         std::lock_guard<std::mutex> lock(pointsmtx);
         clearTransform();
 
-        undoStack.push_back(points);
-        points = redoStack.back();
-        redoStack.pop_back();
+        undoStack.push(points);
+        points = redoStack.pop();
 
         incrementVersion();
     }
+    gestureHasUndo = false;
     buildSegments();
 }
 
+void Pattern::beginGesture()
+{
+    inGesture = true;
+    gestureHasUndo = false;
+}
+
+void Pattern::endGesture()
+{
+    inGesture = false;
+    gestureHasUndo = false;
+}
+
 void Pattern::clearUndo()
 {
     undoStack.clear();
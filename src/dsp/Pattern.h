@@ -11,6 +11,7 @@
 #include <vector>
 #include <mutex>
 #include <atomic>
+#include "UndoHistory.h"
 
 enum PointType {
     Hold,
@@ -31,6 +32,12 @@ struct PPoint {
     int type;
 };
 
+struct PPointEqual {
+    bool operator()(const PPoint& a, const PPoint& b) const {
+        return a.id == b.id && a.x == b.x && a.y == b.y && a.tension == b.tension && a.type == b.type;
+    }
+};
+
 struct Segment {
     double x1;
     double x2;
@@ -45,29 +52,33 @@ class Pattern
 {
 public:
     uint64_t versionID = 0; // unique pattern ID, used by UI to detect pattern changes and update selection
-    static std::vector<PPoint> copy_pattern;
+    std::atomic<uint64_t> segmentsID = 0; // changes every time segments are written, used by UI caches of the pattern shape
     static constexpr double PI = 3.14159265358979323846;
     int index;
-    std::vector<PPoint> points;
+    std::vector<PPoint> points; // always sorted by x, code writing points directly must keep the order or call sortPoints()
     std::vector<Segment> segments;
-    std::vector<std::vector<PPoint>> undoStack;
-    std::vector<std::vector<PPoint>> redoStack;
+    UndoStack<PPoint, PPointEqual> undoStack;
+    UndoStack<PPoint, PPointEqual> redoStack;
     std::atomic<double> tensionMult = 0.0; // tension multiplier applied to all points
     std::atomic<double> tensionAtk = 0.0; // tension multiplier for attack only
     std::atomic<double> tensionRel = 0.0; // tension multiplier for release only
 
     Pattern(int index);
     void incrementVersion(); // generates a new unique ID for this pattern
+    static uint64_t newPointID(); // generates a unique point ID for points built outside insertPoint
+    static uint64_t newPointIDs(size_t count); // reserves count consecutive point IDs, returns the first
 
-    int insertPoint(double x, double y, double tension, int type, bool sort = true);
+    int insertPoint(double x, double y, double tension, int type, bool sort = true); // sort = false appends, the caller sorts once after the batch
     int insertPointUnsafe(double x, double y, double tension, int type, bool sort = true);
-    void sortPoints();
+    void insertPoints(const std::vector<PPoint>& pts); // merges a batch of points into the sorted points, ids are assigned here
+    void insertPointsUnsafe(const std::vector<PPoint>& pts);
+    void sortPoints(); // stable, points on the same x keep their order
     void sortPointsSafe();
     void setTension(double t, double tatk, double trel, bool dual); // sets global tension multiplier
     void removePoint(double x, double y);
     void removePoint(int i);
     void removePointsInRange(double x1, double x2);
-    void removePointsInRangeAux(double x1, double x2);
+    void removePointsInRangeUnsafe(double x1, double x2);
     void invert();
     void reverse();
     void doublePattern();
@@ -76,6 +87,8 @@ public:
     void clear();
     void clearUnsafe();
     void buildSegments();
+    void updateSegments(const std::vector<size_t>& changed); // re-emits only the segments around changed point indexes, rebuilds all if the points order or count changed
+    void updateSegments(size_t first, size_t last); // points first to last (exclusive) were replaced, possibly by a different count, splices only their segments
     void loadSine();
     void loadTriangle();
     void loadRandom(int grid);
@@ -84,6 +97,7 @@ public:
     void transform(double midy_);
     void clearTransform();
     double getavgY();
+    uint64_t getShapeHash(); // hash of everything the y values depend on, patterns with the same shape hash equal across instances
     std::vector<Segment> getSegments();
 
     int getWaveCount(Segment seg);
@@ -96,7 +110,10 @@ public:
     double get_y_smooth_stairs(Segment seg, double x);
     double get_y_at(double x);
 
-    void createUndo();
+    void setUndoBudget(UndoBudget* budget);
+    void createUndo(); // inside a gesture only the first undo point is kept
+    void beginGesture(); // undo points until endGesture are one step, the state before the gesture
+    void endGesture();
     void undo();
     void redo();
     void clearUndo();
@@ -105,9 +122,15 @@ public:
 private:
     double clearY = 0.5; // the y value when the pattern is clear
     std::vector<PPoint> rawpoints; 
-    static inline uint64_t versionIDCounter = 1; // static global ID counter
-    static inline uint64_t pointsIDCounter = 1; // static global ID counter
+    // IDs are shared by all patterns of all instances in the process, instances may run on parallel threads
+    // counters are kept on separate cache lines and point IDs are reserved in blocks for batch inserts
+    alignas(64) static inline std::atomic<uint64_t> versionIDCounter = 1;
+    alignas(64) static inline std::atomic<uint64_t> pointsIDCounter = 1;
+    static std::vector<PPoint> copy_pattern; // clipboard shared by all instances
+    static inline std::mutex copymtx;
     bool dualTension = false;
     std::mutex mtx;
     std::mutex pointsmtx;
+    bool inGesture = false;
+    bool gestureHasUndo = false; // the open gesture already pushed its undo point
 };
\ No newline at end of file
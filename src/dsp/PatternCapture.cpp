@@ -0,0 +1,197 @@
+#include "PatternCapture.h"
+
+PatternCapture::PatternCapture() : Thread("FILTR Pattern Capture")
+{
+	buffer.resize(CAPTURE_BUFFER_SIZE);
+	cycle.reserve(CAPTURE_RESOLUTION * 2);
+}
+
+PatternCapture::~PatternCapture()
+{
+	stopThread(1000);
+}
+
+void PatternCapture::arm(int source_, bool continuous_)
+{
+	source.store(source_);
+	continuous.store(continuous_);
+	state.store(State::Armed);
+
+	// the worker may have seen the idle state just before arming, wait for it and start a new one
+	if (workerExiting.load())
+		stopThread(1000);
+	if (!isThreadRunning()) {
+		workerExiting.store(false);
+		startThread(Thread::Priority::low);
+	}
+}
+
+void PatternCapture::stop()
+{
+	state.store(State::Idle);
+}
+
+void PatternCapture::push(double x, double y)
+{
+	const auto scope = fifo.write(1);
+	if (scope.blockSize1 > 0)
+		buffer[scope.startIndex1] = { x, y };
+	else if (scope.blockSize2 > 0)
+		buffer[scope.startIndex2] = { x, y };
+	else
+		overflow.store(true);
+}
+
+void PatternCapture::process(const double* xs, const double* values, int numSamples, int xstride)
+{
+	int st = state.load();
+	if (st == State::Idle) {
+		lastx = -1.0;
+		return;
+	}
+
+	for (int i = 0; i < numSamples; ++i) {
+		double x = xs[i * xstride];
+		bool wrapped = lastx >= 0.0 && x < lastx - 0.5;
+		lastx = x;
+
+		if (wrapped) {
+			if (st == State::Recording) {
+				if (bin >= 0)
+					push((bin + 0.5) / CAPTURE_RESOLUTION, binValue);
+				push(-1.0, 0.0); // end of cycle marker
+				notify();
+				if (!continuous.load()) {
+					state.store(State::Idle);
+					return;
+				}
+			}
+			st = State::Recording;
+			state.store(st);
+			bin = -1;
+		}
+
+		if (st != State::Recording)
+			continue;
+
+		// decimate into bins keeping the peak of each bin
+		int b = std::clamp((int)(x * CAPTURE_RESOLUTION), 0, CAPTURE_RESOLUTION - 1);
+		if (b != bin) {
+			if (bin >= 0)
+				push((bin + 0.5) / CAPTURE_RESOLUTION, binValue);
+			bin = b;
+			binValue = 0.0;
+		}
+		binValue = std::max(binValue, std::fabs(values[i]));
+	}
+}
+
+void PatternCapture::run()
+{
+	while (!threadShouldExit()) {
+		wait(100);
+
+		while (fifo.getNumReady() > 0) {
+			const auto scope = fifo.read(1);
+			auto value = scope.blockSize1 > 0 ? buffer[scope.startIndex1] : buffer[scope.startIndex2];
+
+			if (value.x >= 0.0) {
+				cycle.push_back(value);
+				continue;
+			}
+
+			// end of cycle, cycles with dropped values are incomplete and discarded
+			if (!overflow.exchange(false) && cycle.size() > 1 && onCapture)
+				onCapture(simplify(cycle));
+			cycle.clear();
+		}
+
+		// leaves once the capture is idle and drained, arm() checks the flag after storing the new state
+		if (state.load() == State::Idle && fifo.getNumReady() == 0) {
+			workerExiting.store(true);
+			if (state.load() == State::Idle) {
+				cycle.clear(); // a stopped capture leaves a partial cycle behind
+				return;
+			}
+			workerExiting.store(false);
+		}
+	}
+}
+
+// Ramer-Douglas-Peucker with an explicit stack, keeps the values further than tolerance from the simplified line
+std::vector<PPoint> PatternCapture::simplify(const std::vector<CaptureValue>& values)
+{
+	double tol = tolerance.load();
+	int size = (int)values.size();
+	std::vector<bool> keep(size, false);
+	keep[0] = true;
+	keep[size - 1] = true;
+
+	std::vector<std::pair<int, int>> stack;
+	stack.push_back({ 0, size - 1 });
+	while (!stack.empty()) {
+		auto [from, to] = stack.back();
+		stack.pop_back();
+
+		auto& a = values[from];
+		auto& b = values[to];
+		double maxdist = 0.0;
+		int index = -1;
+		for (int i = from + 1; i < to; ++i) {
+			double t = (values[i].x - a.x) / (b.x - a.x);
+			double dist = std::fabs(values[i].y - (a.y + t * (b.y - a.y)));
+			if (dist > maxdist) {
+				maxdist = dist;
+				index = i;
+			}
+		}
+
+		if (index != -1 && maxdist > tol) {
+			keep[index] = true;
+			stack.push_back({ from, index });
+			stack.push_back({ index, to });
+		}
+	}
+
+	// pattern y is inverted, 0 is the top of the view
+	std::vector<PPoint> points;
+	int prev = -1;
+	for (int i = 0; i < size; ++i) {
+		if (!keep[i]) continue;
+		if (prev != -1)
+			fitSegment(values, prev, i, points.back());
+		points.push_back({ 0, values[i].x, 1.0 - std::clamp(values[i].y, 0.0, 1.0), 0.0, PointType::Curve });
+		prev = i;
+	}
+
+	return points;
+}
+
+// picks the curve type and tension that best matches the values between two kept points
+void PatternCapture::fitSegment(const std::vector<CaptureValue>& values, int from, int to, PPoint& point)
+{
+	if (to - from < 2)
+		return;
+
+	Segment seg = { values[from].x, values[to].x,
+		1.0 - std::clamp(values[from].y, 0.0, 1.0), 1.0 - std::clamp(values[to].y, 0.0, 1.0), 0.0, 0.0, PointType::Curve };
+
+	double besterr = -1.0;
+	for (int type : { PointType::Curve, PointType::SCurve }) {
+		for (int t = -6; t <= 6; ++t) {
+			seg.tension = t / 10.0;
+			double err = 0.0;
+			for (int i = from + 1; i < to; ++i) {
+				double y = type == PointType::Curve
+					? scratch.get_y_curve(seg, values[i].x)
+					: scratch.get_y_scurve(seg, values[i].x);
+				err += std::fabs(y - (1.0 - std::clamp(values[i].y, 0.0, 1.0)));
+			}
+			if (besterr < 0.0 || err < besterr) {
+				besterr = err;
+				point.tension = seg.tension;
+				point.type = type;
+			}
+		}
+	}
+}
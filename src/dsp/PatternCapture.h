@@ -0,0 +1,70 @@
+// Copyright 2025 tilr
+// Records an envelope over one pattern cycle into pattern points
+// The audio thread streams decimated values through a lock-free ring,
+// a worker thread simplifies each cycle with Ramer-Douglas-Peucker and fits curve tensions
+// the worker only runs while a capture is armed or recording, idle instances have no thread
+#pragma once
+
+#include <JuceHeader.h>
+#include <vector>
+#include <atomic>
+#include <functional>
+#include "Pattern.h"
+#include "../Globals.h"
+
+using namespace globals;
+
+class PatternCapture : private Thread
+{
+public:
+	enum Source {
+		CutEnv, // cutoff envelope follower output
+		Sidechain, // sidechain amplitude, main input when there is no sidechain
+	};
+
+	PatternCapture();
+	~PatternCapture() override;
+
+	void arm(int source, bool continuous); // message thread, starts the worker and records on the next cycle
+	void stop(); // any thread
+	bool isActive() const { return state.load() != State::Idle; }
+
+	// audio thread, values are the source amplitude per sample and xs the pattern positions every xstride samples
+	void process(const double* xs, const double* values, int numSamples, int xstride);
+
+	std::atomic<int> source = Source::CutEnv;
+	std::atomic<double> tolerance = 0.01; // maximum y error of the simplified pattern
+	std::function<void(std::vector<PPoint>)> onCapture; // worker thread, called with the points of each captured cycle
+
+private:
+	enum State {
+		Idle,
+		Armed, // waiting for the cycle start
+		Recording
+	};
+
+	struct CaptureValue {
+		double x;
+		double y;
+	};
+
+	void run() override;
+	void push(double x, double y);
+	std::vector<PPoint> simplify(const std::vector<CaptureValue>& values);
+	void fitSegment(const std::vector<CaptureValue>& values, int from, int to, PPoint& point);
+
+	std::atomic<int> state = State::Idle;
+	std::atomic<bool> continuous = false;
+	std::atomic<bool> overflow = false; // values were dropped, the cycle is discarded
+	std::atomic<bool> workerExiting = false; // the worker saw the capture idle and is leaving
+
+	// audio thread state
+	double lastx = -1.0;
+	int bin = -1;
+	double binValue = 0.0;
+
+	AbstractFifo fifo { CAPTURE_BUFFER_SIZE };
+	std::vector<CaptureValue> buffer;
+	std::vector<CaptureValue> cycle; // worker thread, values of the cycle being read
+	Pattern scratch { -1 }; // worker thread, evaluates curves while fitting tensions
+};
@@ -0,0 +1,159 @@
+#include "Profiler.h"
+
+Profiler::Profiler()
+{
+	reset();
+}
+
+const char* Profiler::getStageName(int stage)
+{
+	static const char* names[kNumStages] = {
+		"Playhead", "Setup", "Upsample", "Transient", "Follower",
+		"Envelope", "Filter", "Display", "Downsample"
+	};
+	return stage >= 0 && stage < kNumStages ? names[stage] : "";
+}
+
+const char* Profiler::getModelName(int model)
+{
+	static const char* names[kNumModels] = {
+		"Linear 12", "Linear 24", "Analog 12", "Analog 24", "Moog 12",
+		"Moog 24", "MS-20", "303", "Phaser+", "Phaser-"
+	};
+	return model >= 0 && model < kNumModels ? names[model] : "";
+}
+
+String Profiler::getBucketName(int bucket)
+{
+	if (bucket == kNumBuckets - 1)
+		return ">=" + String(1 << (kNumBuckets - 2)) + "us";
+	return "<" + String(1 << bucket) + "us";
+}
+
+void Profiler::begin()
+{
+	for (int i = 0; i < kNumStages; ++i)
+		blockTicks[i] = 0;
+	lastTicks = Time::getHighResolutionTicks();
+}
+
+void Profiler::lap(Stage stage)
+{
+	auto now = Time::getHighResolutionTicks();
+	blockTicks[stage] += now - lastTicks;
+	lastTicks = now;
+}
+
+void Profiler::end(int numSamples, double srate, int model)
+{
+	auto deadline = (uint64)(numSamples / srate * 1e9);
+	if (model >= 0 && model < kNumModels) {
+		auto nanos = (uint64)(Time::highResolutionTicksToSeconds(blockTicks[Filter]) * 1e9);
+		modelNanos[model].fetch_add(nanos, std::memory_order_relaxed);
+		modelDeadlineNanos[model].fetch_add(deadline, std::memory_order_relaxed);
+		if (nanos > modelMaxNanos[model].load(std::memory_order_relaxed))
+			modelMaxNanos[model].store(nanos, std::memory_order_relaxed);
+		modelBlocks[model].fetch_add(1, std::memory_order_relaxed);
+	}
+
+	for (int i = 0; i < kNumStages; ++i) {
+		auto nanos = (uint64)(Time::highResolutionTicksToSeconds(blockTicks[i]) * 1e9);
+		auto micros = nanos / 1000;
+
+		int bucket = 0;
+		while (bucket < kNumBuckets - 1 && micros >= (uint64)(1 << bucket))
+			bucket++;
+
+		histograms[i][bucket].fetch_add(1, std::memory_order_relaxed);
+		totalNanos[i].fetch_add(nanos, std::memory_order_relaxed);
+		deadlineNanos[i].fetch_add(deadline, std::memory_order_relaxed);
+		if (nanos > maxNanos[i].load(std::memory_order_relaxed))
+			maxNanos[i].store(nanos, std::memory_order_relaxed);
+		blocks[i].fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+void Profiler::reset()
+{
+	for (int i = 0; i < kNumStages; ++i) {
+		blocks[i].store(0);
+		totalNanos[i].store(0);
+		maxNanos[i].store(0);
+		deadlineNanos[i].store(0);
+		for (int j = 0; j < kNumBuckets; ++j)
+			histograms[i][j].store(0);
+	}
+	for (int i = 0; i < kNumModels; ++i) {
+		modelBlocks[i].store(0);
+		modelNanos[i].store(0);
+		modelMaxNanos[i].store(0);
+		modelDeadlineNanos[i].store(0);
+	}
+}
+
+Profiler::StageStats Profiler::getStats(int stage) const
+{
+	StageStats stats;
+	stats.blocks = blocks[stage].load(std::memory_order_relaxed);
+	if (stats.blocks == 0)
+		return stats;
+
+	auto total = (double)totalNanos[stage].load(std::memory_order_relaxed);
+	auto deadline = (double)deadlineNanos[stage].load(std::memory_order_relaxed);
+	stats.meanMicros = total / stats.blocks / 1000.0;
+	stats.maxMicros = maxNanos[stage].load(std::memory_order_relaxed) / 1000.0;
+	stats.budget = deadline > 0.0 ? total / deadline : 0.0;
+	for (int j = 0; j < kNumBuckets; ++j)
+		stats.buckets[j] = histograms[stage][j].load(std::memory_order_relaxed);
+
+	return stats;
+}
+
+Profiler::StageStats Profiler::getModelStats(int model) const
+{
+	StageStats stats;
+	stats.blocks = modelBlocks[model].load(std::memory_order_relaxed);
+	if (stats.blocks == 0)
+		return stats;
+
+	auto total = (double)modelNanos[model].load(std::memory_order_relaxed);
+	auto deadline = (double)modelDeadlineNanos[model].load(std::memory_order_relaxed);
+	stats.meanMicros = total / stats.blocks / 1000.0;
+	stats.maxMicros = modelMaxNanos[model].load(std::memory_order_relaxed) / 1000.0;
+	stats.budget = deadline > 0.0 ? total / deadline : 0.0;
+	return stats;
+}
+
+String Profiler::toCSV() const
+{
+	String csv = "stage,blocks,mean_us,max_us,budget";
+	for (int j = 0; j < kNumBuckets; ++j)
+		csv << "," << getBucketName(j);
+	csv << "\n";
+
+	for (int i = 0; i < kNumStages; ++i) {
+		auto stats = getStats(i);
+		csv << getStageName(i) << ","
+			<< String(stats.blocks) << ","
+			<< String(stats.meanMicros, 3) << ","
+			<< String(stats.maxMicros, 3) << ","
+			<< String(stats.budget, 5);
+		for (int j = 0; j < kNumBuckets; ++j)
+			csv << "," << String(stats.buckets[j]);
+		csv << "\n";
+	}
+
+	csv << "\nfilter,blocks,mean_us,max_us,budget\n";
+	for (int i = 0; i < kNumModels; ++i) {
+		auto stats = getModelStats(i);
+		if (stats.blocks == 0)
+			continue;
+		csv << getModelName(i) << ","
+			<< String(stats.blocks) << ","
+			<< String(stats.meanMicros, 3) << ","
+			<< String(stats.maxMicros, 3) << ","
+			<< String(stats.budget, 5) << "\n";
+	}
+
+	return csv;
+}
@@ -0,0 +1,68 @@
+// Copyright 2025 tilr
+// Per stage timing counters for the audio thread
+// Stage times are accumulated per block and committed into lock-free histograms read by the UI
+// Laps are taken once per stage per block, never per sample, the filter stage is also attributed to the filter model
+#pragma once
+
+#include <JuceHeader.h>
+#include <atomic>
+
+class Profiler
+{
+public:
+	enum Stage {
+		Playhead,
+		Setup, // param loads, midi queues and other per block bookkeeping
+		Upsample,
+		Transient,
+		Follower,
+		Envelope,
+		Filter,
+		Display,
+		Downsample,
+		kNumStages
+	};
+
+	static constexpr int kNumBuckets = 16; // log2 microsecond buckets, last bucket holds everything above
+	static constexpr int kNumModels = 10; // filter types, see FilterType
+
+	struct StageStats {
+		uint64 blocks = 0;
+		double meanMicros = 0.0;
+		double maxMicros = 0.0;
+		double budget = 0.0; // mean fraction of the block deadline used by this stage
+		uint64 buckets[kNumBuckets] = {};
+	};
+
+	Profiler();
+	~Profiler() {};
+
+	static const char* getStageName(int stage);
+	static String getBucketName(int bucket);
+	static const char* getModelName(int model);
+
+	void begin(); // audio thread, called at the start of the block
+	void lap(Stage stage); // audio thread, assigns the time since the last lap to stage
+	void end(int numSamples, double srate, int model); // audio thread, commits the block times, model is the active filter type
+	void reset(); // any thread
+
+	StageStats getStats(int stage) const;
+	StageStats getModelStats(int model) const; // filter stage stats of the blocks processed by a filter model, no histogram
+	String toCSV() const;
+
+	std::atomic<bool> enabled = false;
+
+private:
+	int64 lastTicks = 0;
+	int64 blockTicks[kNumStages] = {};
+
+	std::atomic<uint64> blocks[kNumStages];
+	std::atomic<uint64> totalNanos[kNumStages];
+	std::atomic<uint64> maxNanos[kNumStages];
+	std::atomic<uint64> deadlineNanos[kNumStages];
+	std::atomic<uint64> histograms[kNumStages][kNumBuckets];
+	std::atomic<uint64> modelBlocks[kNumModels];
+	std::atomic<uint64> modelNanos[kNumModels];
+	std::atomic<uint64> modelMaxNanos[kNumModels];
+	std::atomic<uint64> modelDeadlineNanos[kNumModels];
+};
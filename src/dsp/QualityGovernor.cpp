@@ -0,0 +1,59 @@
+#include "QualityGovernor.h"
+
+void QualityGovernor::reset()
+{
+	tier.store(Tier::Full);
+	load.store(0.0);
+	overloadBlocks = 0;
+	headroomBlocks = 0;
+}
+
+void QualityGovernor::update(double elapsedSecs, int numSamples, double srate)
+{
+	if (numSamples <= 0 || srate <= 0.0)
+		return;
+
+	double deadline = numSamples / srate;
+	double ratio = elapsedSecs / deadline;
+	double smoothed = 0.9 * load.load() + 0.1 * ratio;
+	load.store(smoothed);
+
+	int t = tier.load();
+	if (smoothed > QUALITY_LOAD_HIGH) {
+		headroomBlocks = 0;
+		if (++overloadBlocks >= QUALITY_DOWN_BLOCKS && t < Tier::Lowest) {
+			tier.store(t + 1);
+			overloadBlocks = 0;
+		}
+	}
+	else if (smoothed < QUALITY_LOAD_LOW) {
+		overloadBlocks = 0;
+		if (++headroomBlocks >= QUALITY_UP_BLOCKS && t > Tier::Full) {
+			tier.store(t - 1);
+			headroomBlocks = 0;
+		}
+	}
+	else {
+		overloadBlocks = 0;
+		headroomBlocks = 0;
+	}
+}
+
+int QualityGovernor::getCoeffRate() const
+{
+	return 1 << tier.load(); // 1, 2, 4, 8
+}
+
+int QualityGovernor::getMaxIterations() const
+{
+	int t = tier.load();
+	return t == Tier::Full ? 6
+		: t == Tier::Reduced ? 4
+		: t == Tier::Low ? 3
+		: 2;
+}
+
+int QualityGovernor::getDisplayRate() const
+{
+	return 1 << tier.load();
+}
@@ -0,0 +1,36 @@
+// Copyright 2025 tilr
+// Quality governor, measures block processing time against the block deadline
+// and steps processing quality down under sustained load, up when headroom returns
+#pragma once
+
+#include <atomic>
+#include "../Globals.h"
+
+using namespace globals;
+
+class QualityGovernor
+{
+public:
+	enum Tier {
+		Full,
+		Reduced,
+		Low,
+		Lowest
+	};
+
+	QualityGovernor() {};
+	~QualityGovernor() {};
+
+	void reset();
+	void update(double elapsedSecs, int numSamples, double srate); // call once per block with the block process time
+	int getCoeffRate() const; // oversampled samples between filter coefficient updates
+	int getMaxIterations() const; // iteration cap for filters solved iteratively (MS20)
+	int getDisplayRate() const; // oversampled samples between display captures
+
+	std::atomic<int> tier = Tier::Full;
+	std::atomic<double> load = 0.0; // smoothed ratio between process time and block time
+
+private:
+	int overloadBlocks = 0; // consecutive blocks above the step down threshold
+	int headroomBlocks = 0; // consecutive blocks below the step up threshold
+};
@@ -0,0 +1,38 @@
+#include "UndoHistory.h"
+
+void UndoBudget::add(UndoStackBase* stack)
+{
+	if (std::find(stacks.begin(), stacks.end(), stack) == stacks.end())
+		stacks.push_back(stack);
+}
+
+void UndoBudget::remove(UndoStackBase* stack)
+{
+	stacks.erase(std::remove(stacks.begin(), stacks.end(), stack), stacks.end());
+}
+
+size_t UndoBudget::getBytes() const
+{
+	size_t bytes = 0;
+	for (auto* stack : stacks)
+		bytes += stack->getBytes();
+	return bytes;
+}
+
+void UndoBudget::trim()
+{
+	size_t bytes = getBytes();
+	while (bytes > limit) {
+		UndoStackBase* oldest = nullptr;
+		for (auto* stack : stacks) {
+			if (!stack->empty() && (!oldest || stack->oldestSeq() < oldest->oldestSeq()))
+				oldest = stack;
+		}
+		if (!oldest || oldest->oldestSeq() >= seq)
+			return;
+
+		bytes -= oldest->getBytes();
+		oldest->dropOldest();
+		bytes += oldest->getBytes();
+	}
+}
@@ -0,0 +1,157 @@
+// Copyright 2025 tilr
+// Delta encoded undo stacks sharing a per instance memory budget
+// Only the newest state is stored in full, older states are stored as the range that differs from the next state
+#pragma once
+
+#include <vector>
+#include <deque>
+#include <algorithm>
+#include <cstdint>
+
+class UndoStackBase
+{
+public:
+	virtual ~UndoStackBase() {};
+	virtual bool empty() const = 0;
+	virtual uint64_t oldestSeq() const = 0; // push sequence of the oldest state
+	virtual void dropOldest() = 0;
+	virtual size_t getBytes() const = 0;
+};
+
+// Tracks the memory of a group of undo stacks and evicts the oldest states when over budget
+class UndoBudget
+{
+public:
+	UndoBudget(size_t limit_) : limit(limit_) {};
+	~UndoBudget() {};
+
+	void add(UndoStackBase* stack);
+	void remove(UndoStackBase* stack);
+	uint64_t nextSeq() { return ++seq; }
+	void trim(); // drops the oldest states across all stacks until they fit, never the state just pushed
+	size_t getBytes() const;
+
+private:
+	std::vector<UndoStackBase*> stacks;
+	size_t limit = 0;
+	uint64_t seq = 0;
+};
+
+// Stack of states where Equal compares two elements of a state
+template <typename T, typename Equal>
+class UndoStack : public UndoStackBase
+{
+public:
+	UndoStack() {};
+	~UndoStack() override
+	{
+		if (budget) budget->remove(this);
+	}
+
+	void setBudget(UndoBudget* budget_)
+	{
+		if (budget) budget->remove(this);
+		budget = budget_;
+		if (budget) budget->add(this);
+	}
+
+	void push(const std::vector<T>& state)
+	{
+		uint64_t seq = budget ? budget->nextSeq() : 0;
+		if (hasTip) {
+			deltas.push_back(encode(tip, state, tipSeq));
+			bytes += getDeltaBytes(deltas.back());
+		}
+		bytes -= tip.size() * sizeof(T);
+		tip = state;
+		bytes += tip.size() * sizeof(T);
+		tipSeq = seq;
+		hasTip = true;
+		if (budget) budget->trim();
+	}
+
+	std::vector<T> pop()
+	{
+		std::vector<T> state = std::move(tip);
+		bytes -= state.size() * sizeof(T);
+		tip.clear();
+		hasTip = !deltas.empty();
+		if (hasTip) {
+			auto& delta = deltas.back();
+			tip = decode(delta, state);
+			tipSeq = delta.seq;
+			bytes -= getDeltaBytes(delta);
+			bytes += tip.size() * sizeof(T);
+			deltas.pop_back();
+		}
+		return state;
+	}
+
+	const std::vector<T>& top() const { return tip; } // newest state, valid when not empty
+
+	void clear()
+	{
+		deltas.clear();
+		tip.clear();
+		hasTip = false;
+		bytes = 0;
+	}
+
+	size_t size() const { return deltas.size() + (hasTip ? 1 : 0); }
+	bool empty() const override { return !hasTip; }
+	uint64_t oldestSeq() const override { return deltas.empty() ? tipSeq : deltas.front().seq; }
+	size_t getBytes() const override { return bytes; }
+
+	void dropOldest() override
+	{
+		if (!deltas.empty()) {
+			bytes -= getDeltaBytes(deltas.front());
+			deltas.pop_front();
+		}
+		else if (hasTip) {
+			bytes -= tip.size() * sizeof(T);
+			tip.clear();
+			hasTip = false;
+		}
+	}
+
+private:
+	struct Delta {
+		size_t prefix; // elements shared with the start of the next state
+		size_t suffix; // elements shared with the end of the next state
+		std::vector<T> mid; // elements in between that differ
+		uint64_t seq;
+	};
+
+	Delta encode(const std::vector<T>& state, const std::vector<T>& next, uint64_t seq)
+	{
+		size_t maxShared = std::min(state.size(), next.size());
+		size_t prefix = 0;
+		while (prefix < maxShared && equal(state[prefix], next[prefix]))
+			prefix++;
+		size_t suffix = 0;
+		while (suffix < maxShared - prefix && equal(state[state.size() - 1 - suffix], next[next.size() - 1 - suffix]))
+			suffix++;
+		return { prefix, suffix, std::vector<T>(state.begin() + prefix, state.end() - suffix), seq };
+	}
+
+	std::vector<T> decode(const Delta& delta, const std::vector<T>& next)
+	{
+		std::vector<T> state;
+		state.reserve(delta.prefix + delta.mid.size() + delta.suffix);
+		state.insert(state.end(), next.begin(), next.begin() + delta.prefix);
+		state.insert(state.end(), delta.mid.begin(), delta.mid.end());
+		state.insert(state.end(), next.end() - delta.suffix, next.end());
+		return state;
+	}
+
+	static size_t getDeltaBytes(const Delta& delta) { return sizeof(Delta) + delta.mid.size() * sizeof(T); }
+
+	std::deque<Delta> deltas; // deltas.back() rebuilds the state before tip
+	std::vector<T> tip;
+	bool hasTip = false;
+	uint64_t tipSeq = 0;
+	size_t bytes = 0;
+	UndoBudget* budget = nullptr;
+	Equal equal;
+};
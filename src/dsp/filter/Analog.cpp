@@ -68,6 +68,12 @@ void Analog::reset(double sample)
 	k.reset();
 }
 
+bool Analog::isIdle(double threshold) const
+{
+	return std::fabs(stage1.state) < threshold && std::fabs(stage2.state) < threshold
+		&& std::fabs(pre_stage1.state) < threshold && std::fabs(pre_stage2.state) < threshold;
+}
+
 void Analog::tick()
 {
 	g.tick();
@@ -74,12 +74,14 @@ public:
 	virtual void setMode(FilterMode mode_) { mode = mode_; }
 	virtual void setDrive(double norm) { (void)norm; };
 	virtual void setMorph(double norm) { morph = norm; };
+	virtual void setMaxIterations(int iters) { (void)iters; }; // used by iterative solvers to trade accuracy for cpu
 
 	virtual void init(double srate, double freq, double qnorm) = 0;
 	virtual void reset(double sample) = 0;
 	virtual double eval(double sample) = 0;
 	virtual void setLerp(int duration) = 0;
 	virtual void tick() = 0; // update interpolation of coefficients
+	virtual bool isIdle(double threshold) const = 0; // true when the filter state has decayed below threshold
 
 	inline static double getCoeff(double freq, double srate) {
 		freq = jlimit(20.0, srate * kMinNyquistMult, freq);
@@ -73,6 +73,14 @@ void Linear::reset(double sample)
     a3.reset();
 }
 
+bool Linear::isIdle(double threshold) const
+{
+    return std::fabs(ic1) < threshold && std::fabs(ic2) < threshold
+        && std::fabs(ic3) < threshold && std::fabs(ic4) < threshold
+        && std::fabs(x1) < threshold && std::fabs(x2) < threshold
+        && std::fabs(y1) < threshold && std::fabs(y2) < threshold;
+}
+
 void Linear::tick()
 {
     g.tick();
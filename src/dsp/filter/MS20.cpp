@@ -170,6 +170,12 @@ void MS20::reset(double sample)
     k.reset();
 }
 
+bool MS20::isIdle(double threshold) const
+{
+    return std::fabs(y1) < threshold && std::fabs(y2) < threshold
+        && std::fabs(d1) < threshold && std::fabs(d2) < threshold;
+}
+
 void MS20::tick()
 {
     hh.tick();
@@ -186,4 +192,9 @@ void MS20::setDrive(double drive_)
 {
     drive = std::pow(10.0f, drive_ * F_MAX_DRIVE / 20.0f);
     idrive = 1.0 / std::pow(drive, 0.75);
+}
+
+void MS20::setMaxIterations(int iters)
+{
+    maxiter = std::clamp(iters, 1, kMaxIter);
 }
\ No newline at end of file
@@ -14,7 +14,7 @@ public:
 	MS20() : Filter(kMS20) {}
 	~MS20(){}
 
-	static constexpr int maxiter = 6;
+	static constexpr int kMaxIter = 6;
 	static constexpr double epsilon = 0.00000001;
 
 	void init(double srate, double freq, double q) override;
@@ -25,6 +25,8 @@ public:
 	double evalHP(double sample);
 	void setLerp(int duration) override;
 	void setDrive(double drive) override;
+	void setMaxIterations(int iters) override;
+	bool isIdle(double threshold) const override;
 	void tick() override; // update interpolation of coefficients
 
 private:
@@ -39,4 +41,5 @@ private:
 	double d1 = 0.0;
 	double d2 = 0.0;
 	double obs = 0.0;
+	int maxiter = kMaxIter;
 };
\ No newline at end of file
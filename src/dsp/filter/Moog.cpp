@@ -3,7 +3,7 @@
 void Moog::init(double srate, double freq, double q)
 {
     freq = std::clamp(freq, 20.0, srate / 2.0);
-    f0.set(std::exp(freq * -2.0 * juce::MathConstants<double>::pi / srate));
+    f0.set(poleLUT.cubic(freq / srate));
     k.set(mode == BS ? q * 0.5 : jmap(q, 0.1, 1.0));
 }
 
@@ -97,6 +97,15 @@ void Moog::reset(double sample)
     k.reset();
 }
 
+bool Moog::isIdle(double threshold) const
+{
+    for (auto s : state) {
+        if (std::fabs(s) >= threshold)
+            return false;
+    }
+    return true;
+}
+
 void Moog::setLerp(int nsamples)
 {
     f0.setDuration(nsamples);
@@ -17,12 +17,19 @@ public:
 	void reset(double sample) override;
 	double eval(double sample) override;
 	void setLerp(int duration) override;
+	bool isIdle(double threshold) const override;
 	void tick() override; // update interpolation of coefficients
 	void setDrive(double drive_) override;
 	void setMode(FilterMode mode_) override;
 	void updateState();
 
 private:
+	// one pole coefficient exp(-2pi * freq / srate) over the normalized cutoff, shared by every instance
+	inline static LookupTable poleLUT = LookupTable(
+		[](double ratio) { return std::exp(-2.0 * juce::MathConstants<double>::pi * ratio); },
+		0.0, 0.5, 2048
+	);
+
 	double drive = 1.0;
 	double drive2 = 1.0;
 	double gain = 1.0;
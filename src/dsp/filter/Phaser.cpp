@@ -61,6 +61,17 @@ void Phaser::reset(double sample)
     }
 }
 
+bool Phaser::isIdle(double threshold) const
+{
+    if (std::fabs(remove_highs_stage.state) >= threshold || std::fabs(remove_lows_stage.state) >= threshold)
+        return false;
+    for (int i = 0; i < kMaxStages; ++i) {
+        if (std::fabs(stages[i].state) >= threshold)
+            return false;
+    }
+    return std::fabs(allpass_output) < threshold;
+}
+
 void Phaser::tick()
 {
     g.tick();
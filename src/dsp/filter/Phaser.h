@@ -23,6 +23,7 @@ public:
 	double eval(double sample) override;
 	void setLerp(int duration) override;
 	void setDrive(double drive) override;
+	bool isIdle(double threshold) const override;
 	void tick() override; // update interpolation of coefficients
 
 private:
@@ -15,6 +15,7 @@ public:
 	void hp(double srate, double freq, double q);
 	void clear(double input);
 	double df1(double sample);
+	void getCoeffs(double& b0_, double& b1_, double& b2_, double& a1_, double& a2_) const { b0_ = b0; b1_ = b1; b2_ = b2; a1_ = a1; a2_ = a2; }
 
 private:
 	double a1 = 0.0;
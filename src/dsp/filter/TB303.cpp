@@ -1,66 +1,90 @@
 #include "TB303.h"
 
-void TB303::init(double srate, double freq, double q)
+// Copyright (c) 2012 Dominique Wurtz (www.blaukraut.info)
+TB303::Coeffs TB303::computeCoeffs(double wc)
 {
-    // Copyright (c) 2012 Dominique Wurtz (www.blaukraut.info)
-    wc1.set(coeffLUT(0.45 * MathConstants<double>::pi * freq / srate * 0.5));
-    double wc = wc1.get();
-    wc2 = wc * wc;
-
-    wc2 = wc*wc;
-    wc3 = wc2*wc;
-    wc4 = wc3*wc;
-    b   = 1.0 / ( 1.0 + 8.0*wc + 20.0*wc2 + 16.0*wc3 + 2.0*wc4);
-    g   = 2.0 * wc4 * b;
-
-    if (mode == BS) q *= 0.13;
-    k   = 16.95*q;
-    A   = 1 + 0.5 * k.get();
-
+    double wc2 = wc*wc;
+    double wc3 = wc2*wc;
+    double wc4 = wc3*wc;
     double dwc = 2*wc;
     double dwc2 = 2*wc2;
     double qwc2 = 4*wc2;
     double dwc3 = 2*wc3;
     double qwc3 = 4*wc3;
 
-    b0 = dwc+12*wc2+20*wc3+8*wc4;
-    a0 = 1+6*wc+10*wc2+qwc3;
-    a1 = dwc+8*wc2+6*wc3;
-    a2 = dwc2+wc3;
-    a3 = dwc3;
-
-    b10 = dwc2+8*wc3+6*wc4;
-    a10 = wc+4*wc2+3*wc3;
-    a11 = 1+6*wc+11*wc2+6*wc3;
-    a12 = wc+qwc2+qwc3;
-    a13 = wc2+dwc3;
+    Coeffs c;
+    c[B] = 1.0 / ( 1.0 + 8.0*wc + 20.0*wc2 + 16.0*wc3 + 2.0*wc4);
+    c[G] = 2.0 * wc4 * c[B];
+
+    c[B0] = dwc+12*wc2+20*wc3+8*wc4;
+    c[A0] = 1+6*wc+10*wc2+qwc3;
+    c[A1] = dwc+8*wc2+6*wc3;
+    c[A2] = dwc2+wc3;
+    c[A3] = dwc3;
+
+    c[B10] = dwc2+8*wc3+6*wc4;
+    c[A10] = wc+4*wc2+3*wc3;
+    c[A11] = 1+6*wc+11*wc2+6*wc3;
+    c[A12] = wc+qwc2+qwc3;
+    c[A13] = wc2+dwc3;
+
+    c[B20] = dwc3+4*wc4;
+    c[A21] = wc+qwc2+4*wc3;
+    c[A22] = 1+6*wc+10*wc2+qwc3;
+    c[A23] = wc+qwc2+dwc3;
+
+    c[C2] = c[A21] - c[A3];
+    c[C3] = 1+6*wc+9*wc2+dwc3;
+    return c;
+}
 
-    b20 = dwc3+4*wc4;
-    a20 = a13;
-    a21 = wc+qwc2+4*wc3;
-    a22 = 1+6*wc+10*wc2+qwc3;
-    a23 = wc+qwc2+dwc3;
+std::vector<TB303::Coeffs> TB303::buildTable()
+{
+    std::vector<Coeffs> table(kTableSize);
+    for (int i = 0; i < kTableSize; ++i)
+        table[i] = computeCoeffs(kTableMaxWc * i / (kTableSize - 1));
+    return table;
+}
 
-    c2  = a21 - a3;
-    c3  = 1+6*wc+9*wc2+dwc3;
+void TB303::init(double srate, double freq, double q)
+{
+    wc1.set(coeffLUT(0.45 * MathConstants<double>::pi * freq / srate * 0.5));
+    double wc = wc1.get();
+    wc3 = wc*wc*wc;
+
+    // coefficients are interpolated from the shared table instead of solving the polynomials per sample
+    double pos = wc * (kTableSize - 1) / kTableMaxWc;
+    int i = (int)pos;
+    if (i >= kTableSize - 1) {
+        c = computeCoeffs(wc);
+    }
+    else {
+        double t = pos - i;
+        const auto& c0 = coeffTable[i];
+        const auto& c1 = coeffTable[i + 1];
+        for (int n = 0; n < kNumCoeffs; ++n)
+            c[n] = c0[n] + t * (c1[n] - c0[n]);
+    }
 
-    sc = (57.96533646143774 - 26.63612328945456*exp(- 0.44872755850609214 * k.get())) / 31.329213171983177;
+    if (mode == BS) q *= 0.13;
+    k   = 16.95*q;
+    A   = 1 + 0.5 * k.get();
 }
 
 double TB303::eval(double sample)
 {
     sample *= drive;
     double wc = wc1.get();
-    double s = (z0*wc3 + z1*a20 + z2*c2 + z3*c3) * b;
-    y4 = (g * sample + s) / (1.0 + g*k.get());
+    double s = (z0*wc3 + z1*c[A13] + z2*c[C2] + z3*c[C3]) * c[B];
+    y4 = (c[G] * sample + s) / (1.0 + c[G]*k.get());
 
     double fb = sample - k.get()*y4;
     double y0 = std::clamp(fb, -1.0, 1.0);
 
-    y1 = b * (y0*b0 + z0*a0 + z1*a1 + z2*a2 + z3*a3);
-    y2 = b * (y0*b10 + z0*a10 + z1*a11 + z2*a12 + z3*a13);  
-    y3 = b * (y0*b20 + z0*a20 + z1*a21 + z2*a22 + z3*a23);
-    y4 = g*y0 + s;
+    y1 = c[B] * (y0*c[B0] + z0*c[A0] + z1*c[A1] + z2*c[A2] + z3*c[A3]);
+    y2 = c[B] * (y0*c[B10] + z0*c[A10] + z1*c[A11] + z2*c[A12] + z3*c[A13]);
+    y3 = c[B] * (y0*c[B20] + z0*c[A13] + z1*c[A21] + z2*c[A22] + z3*c[A23]);
+    y4 = c[G]*y0 + s;
 
     z0 += 4*wc*(y0 - y1   + y2);
     z1 += 2*wc*(y1 - 2*y2 + y3);
@@ -86,6 +110,14 @@ void TB303::reset(double sample)
     k.reset();
 }
 
+bool TB303::isIdle(double threshold) const
+{
+    return std::fabs(z0) < threshold && std::fabs(z1) < threshold
+        && std::fabs(z2) < threshold && std::fabs(z3) < threshold
+        && std::fabs(y1) < threshold && std::fabs(y2) < threshold
+        && std::fabs(y3) < threshold && std::fabs(y4) < threshold;
+}
+
 void TB303::tick()
 {
     wc1.tick();
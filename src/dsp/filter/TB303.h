@@ -6,6 +6,8 @@
 #include <JuceHeader.h>
 #include "Filter.h"
 #include <cmath>
+#include <array>
+#include <vector>
 
 class TB303 : public Filter
 {
@@ -19,22 +21,29 @@ public:
 	double eval(double sample) override;
 	void setLerp(int duration) override;
 	void setDrive(double drive) override;
+	bool isIdle(double threshold) const override;
 	void tick() override; // update interpolation of coefficients
 
 private:
+	// coefficients of the 4 pole structure, they only depend on wc
+	enum Coeff { B, G, B0, A0, A1, A2, A3, B10, A10, A11, A12, A13, B20, A21, A22, A23, C2, C3, kNumCoeffs };
+	using Coeffs = std::array<double, kNumCoeffs>;
+
+	static constexpr int kTableSize = 2048;
+	static constexpr double kTableMaxWc = 2.1; // wc of a cutoff at nyquist, higher values are computed directly
+	static Coeffs computeCoeffs(double wc);
+	static std::vector<Coeffs> buildTable();
+	inline static const std::vector<Coeffs> coeffTable = buildTable(); // shared by every instance, rate independent
+
 	double drive = 1.0;
 	double idrive = 1.0;
 
 	Lerp wc1;
 	Lerp k;
-	double wc2 = 0.0;
 	double wc3 = 0.0;
-	double wc4 = 0.0;
+	double A = 0.0;
+	Coeffs c = {};
 
-	double A = 0.0; 
-	double b = 0.0;
-	double g = 0.0;
-	
 	double z0 = 0.0;
 	double z1 = 0.0;
 	double z2 = 0.0;
@@ -43,23 +52,4 @@ private:
 	double y2 = 0.0;
 	double y3 = 0.0;
 	double y4 = 0.0;
-		
-	double b0 = 0.0;
-	double a0 = 0.0;
-	double a1 = 0.0;
-	double a2 = 0.0;
-	double a3 = 0.0;
-	double b10 = 0.0;
-	double a10 = 0.0;
-	double a11 = 0.0;
-	double a12 = 0.0;
-	double a13 = 0.0;
-	double b20 = 0.0;
-	double a20 = 0.0;
-	double a21 = 0.0;
-	double a22 = 0.0;
-	double a23 = 0.0;
-	double c2 = 0.0;
-	double c3 = 0.0;
-	double sc = 0.0;
 };
\ No newline at end of file
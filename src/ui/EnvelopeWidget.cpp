@@ -75,10 +75,8 @@ EnvelopeWidget::EnvelopeWidget(FILTRAudioProcessor& p, bool isResenv, int width)
     autoRelBtn.onClick = [this, isResenv] {
         if (isResenv) audioProcessor.resenvAutoRel = !audioProcessor.resenvAutoRel;
         else audioProcessor.cutenvAutoRel = !audioProcessor.cutenvAutoRel;
-        MessageManager::callAsync([this]{ 
-            audioProcessor.onSlider();
-            audioProcessor.sendChangeMessage(); 
-        });
+        audioProcessor.markDirty(isResenv ? FILTRAudioProcessor::DirtyResEnv : FILTRAudioProcessor::DirtyCutEnv);
+        MessageManager::callAsync([this]{ audioProcessor.sendChangeMessage(); });
     };
     if (!isResenv) {
         autoRelBtn.setColour(TextButton::buttonColourId, Colour(0xffffffff));
@@ -0,0 +1,165 @@
+#include "LibraryBrowser.h"
+#include "../PluginProcessor.h"
+
+LibraryBrowser::LibraryBrowser(FILTRAudioProcessor& p) : audioProcessor(p)
+{
+    auto addButton = [this](TextButton& button, String label) {
+        addAndMakeVisible(button);
+        button.setButtonText(label);
+        button.setComponentID("button");
+        button.setColour(TextButton::buttonColourId, Colour(COLOR_ACTIVE));
+        button.setColour(TextButton::textColourOffId, Colour(COLOR_ACTIVE));
+    };
+
+    addButton(folderButton, "Folder");
+    folderButton.onClick = [this]() { chooseFolder(); };
+    addButton(rescanButton, "Rescan");
+    rescanButton.onClick = [this]() { audioProcessor.library.rescan(); repaint(); };
+    addButton(closeButton, "Close");
+    closeButton.onClick = [this]() { setVisible(false); };
+
+    addAndMakeVisible(searchBox);
+    searchBox.setTextToShowWhenEmpty("Search", Colour(COLOR_NEUTRAL));
+    searchBox.setColour(TextEditor::backgroundColourId, Colour(COLOR_BG));
+    searchBox.setColour(TextEditor::outlineColourId, Colour(COLOR_NEUTRAL));
+    searchBox.setColour(TextEditor::focusedOutlineColourId, Colour(COLOR_ACTIVE));
+    searchBox.onTextChange = [this]() { updateResults(); };
+
+    addAndMakeVisible(list);
+    list.setModel(this);
+    list.setRowHeight(36);
+    list.setColour(ListBox::backgroundColourId, Colours::transparentBlack);
+
+    audioProcessor.library.addChangeListener(this);
+}
+
+LibraryBrowser::~LibraryBrowser()
+{
+    audioProcessor.library.removeChangeListener(this);
+    list.setModel(nullptr);
+}
+
+void LibraryBrowser::visibilityChanged()
+{
+    // the library is only scanned while browsing, unchanged files are reused from the index
+    if (isVisible() && audioProcessor.libraryFolder.isNotEmpty()) {
+        audioProcessor.library.setFolder(File(audioProcessor.libraryFolder));
+        updateResults();
+    }
+}
+
+void LibraryBrowser::chooseFolder()
+{
+    fileChooser.reset(new juce::FileChooser("Select patterns library folder", File(audioProcessor.libraryFolder)));
+    fileChooser->launchAsync(juce::FileBrowserComponent::openMode |
+        juce::FileBrowserComponent::canSelectDirectories, [this](const juce::FileChooser& fc)
+        {
+            auto folder = fc.getResult();
+            if (!folder.isDirectory())
+                return;
+
+            audioProcessor.libraryFolder = folder.getFullPathName();
+            audioProcessor.saveSettings();
+            audioProcessor.library.setFolder(folder);
+        });
+}
+
+void LibraryBrowser::updateResults()
+{
+    results = audioProcessor.library.search(searchBox.getText());
+    list.deselectAllRows();
+    list.updateContent();
+    repaint();
+}
+
+void LibraryBrowser::changeListenerCallback(ChangeBroadcaster* source)
+{
+    (void)source;
+    updateResults();
+}
+
+int LibraryBrowser::getNumRows()
+{
+    return (int)results.size();
+}
+
+void LibraryBrowser::paintListBoxItem(int row, Graphics& g, int width, int height, bool selected)
+{
+    if (row < 0 || row >= (int)results.size())
+        return;
+
+    auto* entry = audioProcessor.library.getEntry(results[row]);
+    if (entry == nullptr)
+        return;
+
+    if (selected)
+        g.fillAll(Colour(COLOR_ACTIVE).withAlpha(0.2f));
+
+    // thumbnail
+    auto thumb = Rectangle<float>(2.f, 2.f, 96.f, height - 4.f);
+    g.setColour(Colour(COLOR_NEUTRAL).withAlpha(0.5f));
+    g.drawRect(thumb, 1.f);
+    Path path;
+    for (int i = 0; i < PatternLibrary::kThumbWidth; ++i) {
+        auto x = thumb.getX() + thumb.getWidth() * (i + 0.5f) / PatternLibrary::kThumbWidth;
+        auto y = thumb.getY() + thumb.getHeight() * entry->thumb[i] / 255.f;
+        if (i == 0) path.startNewSubPath(x, y);
+        else path.lineTo(x, y);
+    }
+    g.setColour(Colour(COLOR_ACTIVE));
+    g.strokePath(path, PathStrokeType(1.f));
+
+    auto text = Rectangle<int>(110, 0, width - 110, height);
+    auto name = String::fromUTF8(entry->file, (int)strnlen(entry->file, PatternLibrary::kFileSize));
+    auto pat = (entry->line < 12 ? "Cut " : "Res ") + String(entry->line % 12 + 1);
+    g.setFont(FontOptions(14.f));
+    g.setColour(Colours::white);
+    g.drawText(name + "  " + pat, text.removeFromTop(height / 2), Justification::bottomLeft);
+    g.setColour(Colour(COLOR_NEUTRAL_LIGHT));
+    g.drawText(String(entry->points) + " points, avg " + String(entry->avgY * 100.f, 0) + "%  "
+        + String::fromUTF8(entry->tags, (int)strnlen(entry->tags, PatternLibrary::kTagsSize)),
+        text, Justification::topLeft);
+}
+
+void LibraryBrowser::selectedRowsChanged(int row)
+{
+    if (row < 0 || row >= (int)results.size())
+        return;
+
+    // the pattern is read off the message thread, the browser may be gone when it arrives
+    SafePointer<LibraryBrowser> safeThis(this);
+    audioProcessor.library.loadPoints(results[row], [safeThis](std::vector<PPoint> points) {
+        if (safeThis != nullptr)
+            safeThis->audioProcessor.replaceViewPattern(points);
+    });
+}
+
+void LibraryBrowser::resized()
+{
+    auto col = getWidth() - PLUG_PADDING - 60;
+    closeButton.setBounds(col, PLUG_PADDING, 60, 25); col -= 70;
+    rescanButton.setBounds(col, PLUG_PADDING, 60, 25); col -= 70;
+    folderButton.setBounds(col, PLUG_PADDING, 60, 25); col -= 10;
+    searchBox.setBounds(PLUG_PADDING + 130, PLUG_PADDING, std::max(50, col - PLUG_PADDING - 130), 25);
+    list.setBounds(getLocalBounds().reduced(PLUG_PADDING).withTrimmedTop(35));
+}
+
+void LibraryBrowser::paint(Graphics& g)
+{
+    g.fillAll(Colour(0xdd000000));
+
+    auto bounds = getLocalBounds().reduced(PLUG_PADDING);
+    g.setFont(FontOptions(16.f));
+    g.setColour(Colours::white);
+    g.drawText("Library", bounds.removeFromTop(25).removeFromLeft(120), Justification::centredLeft);
+
+    auto& library = audioProcessor.library;
+    if (results.empty()) {
+        g.setFont(FontOptions(14.f));
+        g.setColour(Colour(COLOR_NEUTRAL_LIGHT));
+        auto text = audioProcessor.libraryFolder.isEmpty() ? "Select a folder with .12pat files"
+            : library.isScanning() ? "Scanning.."
+            : "No patterns found";
+        g.drawText(text, bounds.withTrimmedTop(10).removeFromTop(25), Justification::centredLeft);
+    }
+}
@@ -0,0 +1,48 @@
+/*
+  ==============================================================================
+
+    LibraryBrowser.h
+    Author:  tiagolr
+
+    Browses the pattern library over the view, clicking a row previews
+    the pattern into the view pattern
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <vector>
+#include "../Globals.h"
+
+using namespace globals;
+class FILTRAudioProcessor;
+
+class LibraryBrowser : public juce::Component, private juce::ListBoxModel, private juce::ChangeListener
+{
+public:
+    LibraryBrowser(FILTRAudioProcessor& p);
+    ~LibraryBrowser() override;
+
+    void visibilityChanged() override;
+    void resized() override;
+    void paint(Graphics& g) override;
+    void chooseFolder();
+
+private:
+    FILTRAudioProcessor& audioProcessor;
+    TextEditor searchBox;
+    ListBox list;
+    TextButton folderButton;
+    TextButton rescanButton;
+    TextButton closeButton;
+    std::vector<int> results; // library entry indexes matching the search
+    std::unique_ptr<juce::FileChooser> fileChooser;
+
+    void updateResults();
+    int getNumRows() override;
+    void paintListBoxItem(int row, Graphics& g, int width, int height, bool selected) override;
+    void selectedRowsChanged(int row) override;
+    void changeListenerCallback(ChangeBroadcaster* source) override;
+};
@@ -13,16 +13,38 @@ Meter::Meter(FILTRAudioProcessor& p) : audioProcessor(p)
     gainMeter = gainToScale(gain);
     zeroMeter = gainToScale(1.0);
 
+    audioProcessor.metering.setEnabled(true);
     startTimerHz(60);
 }
 
 void Meter::timerCallback()
 {
+    audioProcessor.metering.update();
+    input = audioProcessor.metering.getReadout(Metering::Input);
+    wet = audioProcessor.metering.getReadout(Metering::Wet);
+    output = audioProcessor.metering.getReadout(Metering::Output);
+
+    // gain staging readouts, refreshed a few times per second so they stay readable
+    if (++tooltipFrames >= 15) {
+        tooltipFrames = 0;
+        auto toDb = [](float g) {
+            return g < 0.00001f ? String("-inf") : String(Utils::gainTodB((double)g), 1);
+        };
+        auto describe = [&](const Metering::Readout& r) {
+            return "Peak " + toDb(std::max(r.peak[0], r.peak[1])) + " dB"
+                + "  TP " + toDb(std::max(r.truePeak[0], r.truePeak[1])) + " dBTP"
+                + "  RMS " + toDb(std::max(r.rms[0], r.rms[1])) + " dB"
+                + "  " + (r.loudness > -70.f ? String(r.loudness, 1) : String("-inf")) + " LUFS";
+        };
+        setTooltip("In:  " + describe(input) + "\nWet: " + describe(wet) + "\nOut: " + describe(output));
+    }
+
     repaint();
 }
 
 Meter::~Meter()
 {
+    audioProcessor.metering.setEnabled(false);
     audioProcessor.params.removeParameterListener("gain", this);
 }
 
@@ -40,8 +62,8 @@ void Meter::paint(juce::Graphics& g) {
     g.drawRoundedRectangle(getLocalBounds().expanded(-1,-1).toFloat().translated(0.5f, 0.5f), 3.f, 1.f);
     auto bounds = getLocalBounds().expanded(-4, -4).toFloat().translated(0.5f, 0.5f);
 
-    double rmsLeft = gainToScale(audioProcessor.rmsLeft.load());
-    double rmsRight = gainToScale(audioProcessor.rmsRight.load());
+    double rmsLeft = gainToScale(output.rms[0]);
+    double rmsRight = gainToScale(output.rms[1]);
 
     g.setColour(Colour(COLOR_ACTIVE));
     if (rmsLeft > -60.0)
@@ -49,6 +71,23 @@ void Meter::paint(juce::Graphics& g) {
     if (rmsRight > -60.0)
         g.fillRect(bounds.withTrimmedTop(bounds.getHeight() / 2).withRight(bounds.getWidth() * (float)rmsRight));
 
+    // true-peak ticks, drawn in the audio colour once the output goes over 0dB
+    for (int channel = 0; channel < 2; ++channel) {
+        auto tp = output.truePeak[channel];
+        if (tp < 0.001f) continue;
+        auto half = channel == 0 ? bounds.withTrimmedBottom(bounds.getHeight() / 2) : bounds.withTrimmedTop(bounds.getHeight() / 2);
+        g.setColour(Colour(tp > 1.f ? COLOR_AUDIO : COLOR_NEUTRAL_LIGHT));
+        g.fillRect(half.withX(bounds.getX() + bounds.getWidth() * (float)gainToScale(tp) - 1.f).withWidth(2.f));
+    }
+
+    // quality governor tier, only shown when quality is reduced
+    int tier = audioProcessor.governor.tier.load();
+    if (audioProcessor.autoQuality && tier > 0) {
+        g.setFont(FontOptions(11.f));
+        g.setColour(Colour(COLOR_AUDIO));
+        g.drawText("Q-" + String(tier), bounds.withTrimmedRight(2.f), Justification::centredRight);
+    }
+
     if (mouse_down) {
         g.setColour(Colour(COLOR_BG).withAlpha(0.8f));
         g.fillRect(bounds);
@@ -3,6 +3,7 @@
 #include <JuceHeader.h>
 #include "../Globals.h"
 #include "../dsp/Utils.h"
+#include "../dsp/Metering.h"
 
 using namespace globals;
 class FILTRAudioProcessor;
@@ -32,4 +33,8 @@ private:
     bool mouse_down = false;
     float cur_normed_value = 0.0;
     Point<int> last_mouse_position;
+    Metering::Readout input;
+    Metering::Readout wet;
+    Metering::Readout output;
+    int tooltipFrames = 0;
 };
\ No newline at end of file
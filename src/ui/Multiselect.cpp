@@ -522,6 +522,10 @@ void Multiselect::dragQuad(const MouseEvent& e)
 // now uses bilinear interpolation to place the points in a defined quad instead of rectangle area
 void Multiselect::updatePointsToSelection()
 {
+    auto& points = audioProcessor.viewPattern->points;
+    pointIndexes.resize(selectionPoints.size(), points.size());
+    changedIndexes.clear();
+
     for (size_t i = 0; i < selectionPoints.size(); ++i) {
         auto& p = selectionPoints[i];
 
@@ -535,20 +539,27 @@ void Multiselect::updatePointsToSelection()
         p.x = newpos.x;
         p.y = newpos.y;
 
-        // update pattern point
-        auto& points = audioProcessor.viewPattern->points;
-        for (size_t j = 0; j < points.size(); ++j) {
-            auto& pp = points[j];
-            if (pp.id == p.id) {
-                pp.x = newpos.x;
-                pp.y = newpos.y;
-                break;
+        // update pattern point, the cached index is only searched again when the points were reordered
+        auto j = pointIndexes[i];
+        if (j >= points.size() || points[j].id != p.id) {
+            j = points.size();
+            for (size_t k = 0; k < points.size(); ++k) {
+                if (points[k].id == p.id) {
+                    j = k;
+                    break;
+                }
             }
+            pointIndexes[i] = j;
+        }
+        if (j < points.size()) {
+            points[j].x = newpos.x;
+            points[j].y = newpos.y;
+            changedIndexes.push_back(j);
         }
     }
 
-    audioProcessor.viewPattern->sortPoints();
-    audioProcessor.viewPattern->buildSegments();
+    // patches only the segments around the moved points, sorts and rebuilds when points crossed their neighbours
+    audioProcessor.viewPattern->updateSegments(changedIndexes);
 }
 
 void Multiselect::deleteSelectedPoints()
@@ -92,6 +92,8 @@ private:
     Quad quadrel = { Vec2(0.0, 0.0), Vec2(0.0, 0.0), Vec2(0.0, 0.0), Vec2(0.0, 0.0) };
     bool invertx = false;
     bool inverty = false;
+    std::vector<size_t> pointIndexes; // cached pattern index of each selection point, checked against the point id before use
+    std::vector<size_t> changedIndexes;
 
     void dragArea(const MouseEvent& e);
     void dragQuad(const MouseEvent& e);
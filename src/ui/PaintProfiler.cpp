@@ -0,0 +1,118 @@
+#include "PaintProfiler.h"
+
+const char* PaintProfiler::getPartName(int part)
+{
+    static const char* names[kNumParts] = {
+        "Background", "Wave", "Grid", "Segments", "Points", "Overlays", "Sequencer"
+    };
+    return part >= 0 && part < kNumParts ? names[part] : "";
+}
+
+void PaintProfiler::begin()
+{
+    for (int i = 0; i < kNumParts; ++i)
+        frameTicks[i] = 0;
+    lastTicks = Time::getHighResolutionTicks();
+}
+
+void PaintProfiler::lap(Part part)
+{
+    auto now = Time::getHighResolutionTicks();
+    frameTicks[part] += now - lastTicks;
+    lastTicks = now;
+}
+
+void PaintProfiler::end()
+{
+    for (int i = 0; i < kNumParts; ++i) {
+        auto millis = Time::highResolutionTicksToSeconds(frameTicks[i]) * 1000.0;
+        totalMillis[i] += millis;
+        maxMillis[i] = std::max(maxMillis[i], millis);
+    }
+    frames++;
+}
+
+void PaintProfiler::reset()
+{
+    frames = 0;
+    for (int i = 0; i < kNumParts; ++i) {
+        totalMillis[i] = 0.0;
+        maxMillis[i] = 0.0;
+    }
+}
+
+PaintProfiler::PartStats PaintProfiler::getStats(int part) const
+{
+    PartStats stats;
+    stats.frames = frames;
+    if (frames == 0)
+        return stats;
+
+    stats.meanMillis = totalMillis[part] / frames;
+    stats.maxMillis = maxMillis[part];
+    return stats;
+}
+
+std::vector<PaintProfiler::BenchResult> PaintProfiler::runBench(Component& comp, int numFrames)
+{
+    static const float scales[] = { 1.f, 1.5f, 2.f };
+
+    auto wasEnabled = enabled;
+    enabled = true;
+    reset();
+    benchResults.clear();
+
+    for (auto scale : scales) {
+        BenchResult result;
+        result.scale = scale;
+        result.width = roundToInt(comp.getWidth() * scale);
+        result.height = roundToInt(comp.getHeight() * scale);
+        if (result.width <= 0 || result.height <= 0)
+            continue;
+
+        // one image per scale, like a cached backing store, so the frames measure painting only
+        Image image(Image::ARGB, result.width, result.height, true);
+        double total = 0.0;
+        for (int i = 0; i < numFrames; ++i) {
+            auto start = Time::getHighResolutionTicks();
+            {
+                Graphics g(image);
+                g.addTransform(AffineTransform::scale(scale));
+                comp.paintEntireComponent(g, false);
+            }
+            auto millis = Time::highResolutionTicksToSeconds(Time::getHighResolutionTicks() - start) * 1000.0;
+            total += millis;
+            result.maxMillis = std::max(result.maxMillis, millis);
+        }
+        result.meanMillis = total / std::max(1, numFrames);
+        benchResults.push_back(result);
+    }
+
+    enabled = wasEnabled;
+    return benchResults;
+}
+
+String PaintProfiler::toCSV() const
+{
+    String csv = "part,frames,mean_ms,max_ms\n";
+    for (int i = 0; i < kNumParts; ++i) {
+        auto stats = getStats(i);
+        csv << getPartName(i) << ","
+            << String(stats.frames) << ","
+            << String(stats.meanMillis, 4) << ","
+            << String(stats.maxMillis, 4) << "\n";
+    }
+
+    if (!benchResults.empty()) {
+        csv << "\nscale,width,height,mean_ms,max_ms\n";
+        for (auto& result : benchResults) {
+            csv << String(result.scale, 2) << ","
+                << String(result.width) << ","
+                << String(result.height) << ","
+                << String(result.meanMillis, 4) << ","
+                << String(result.maxMillis, 4) << "\n";
+        }
+    }
+
+    return csv;
+}
@@ -0,0 +1,76 @@
+/*
+  ==============================================================================
+
+    PaintProfiler.h
+    Author:  tiagolr
+
+    Per part timing counters for the view paint, message thread only
+    Also renders a component offscreen at several scales to measure frame times
+    without depending on the host repaint rate
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <vector>
+
+class PaintProfiler
+{
+public:
+    enum Part {
+        Background,
+        Wave,
+        Grid,
+        Segments,
+        Points,
+        Overlays, // paint tool, selection and multiselect
+        Sequencer,
+        kNumParts
+    };
+
+    struct PartStats {
+        uint64 frames = 0;
+        double meanMillis = 0.0;
+        double maxMillis = 0.0;
+    };
+
+    struct BenchResult {
+        float scale = 1.f;
+        int width = 0;
+        int height = 0;
+        double meanMillis = 0.0;
+        double maxMillis = 0.0;
+    };
+
+    static const char* getPartName(int part);
+
+    void begin(); // called at the start of the paint
+    void lap(Part part); // assigns the time since the last lap to part
+    void end(); // commits the frame times
+    void reset();
+
+    PartStats getStats(int part) const;
+
+    /**
+     * Renders the component into offscreen images, the part counters are reset
+     * and collect the bench frames only
+     * @param comp Component to render, painted with its children
+     * @param frames Frames rendered per scale
+     */
+    std::vector<BenchResult> runBench(Component& comp, int frames = 60);
+    const std::vector<BenchResult>& getBenchResults() const { return benchResults; }
+
+    String toCSV() const;
+
+    bool enabled = false;
+
+private:
+    int64 lastTicks = 0;
+    int64 frameTicks[kNumParts] = {};
+    uint64 frames = 0;
+    double totalMillis[kNumParts] = {};
+    double maxMillis[kNumParts] = {};
+    std::vector<BenchResult> benchResults;
+};
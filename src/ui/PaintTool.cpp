@@ -143,6 +143,8 @@ void PaintTool::apply()
     if (inverty) pat->invert();
     pat->buildSegments();
 
+    std::vector<PPoint> pts;
+    pts.reserve(pat->points.size());
     for (auto& point : pat->points) {
         double px = rx + point.x * rw; // map points to rectangle bounds
         double py = ry + point.y * rh;
@@ -150,8 +152,9 @@ void PaintTool::apply()
         py = (py - winy) / winh;
         px = jlimit(0.0, 1.0, px);
         py = jlimit(0.0, 1.0, py);
-        audioProcessor.viewPattern->insertPoint(px, py, point.tension, point.type);
+        pts.push_back({ 0, px, py, point.tension, point.type });
     }
+    audioProcessor.viewPattern->insertPoints(pts);
 
     audioProcessor.viewPattern->buildSegments();
 }
@@ -131,31 +131,8 @@ std::vector<Rectangle<int>> PaintToolWidget::getPatRects()
 
 void PaintToolWidget::drawPattern(Graphics& g, Rectangle<int> bounds, int index, Colour color)
 {
-    auto pattern = audioProcessor.getPaintPatern(index);
-
-    int x = bounds.getX();
-    int y = bounds.getY();
-    int w = bounds.getWidth();
-    int h = bounds.getHeight();
-    double lastX = x;
-    double lastY = pattern->get_y_at(0) * h + y;
-
-    Path path;
-
-    path.startNewSubPath((float)lastX, (float)lastY);
-
-    for (int i = 0; i < w + 1; ++i)
-    {
-        double px = double(i) / double(w);
-        double py = pattern->get_y_at(px) * h + y;
-        float xx = (float)(i + x);
-        float yy = (float)py;
-
-        path.lineTo(xx, yy);
-    }
-
     g.setColour(color);
-    g.strokePath(path, PathStrokeType(1.f));
+    thumbnails->draw(g, *audioProcessor.getPaintPatern(index), bounds);
 }
 
 void PaintToolWidget::mouseDown(const juce::MouseEvent& e) 
@@ -2,6 +2,7 @@
 
 #include <JuceHeader.h>
 #include "../Globals.h"
+#include "PatternThumbnails.h"
 
 using namespace globals;
 class FILTRAudioProcessor;
@@ -26,4 +27,5 @@ public:
 
 private:
     FILTRAudioProcessor& audioProcessor;
+    SharedResourcePointer<PatternThumbnails> thumbnails; // shared by all editors in the process
 };
\ No newline at end of file
@@ -0,0 +1,76 @@
+#include "PatternThumbnails.h"
+#include "../dsp/Pattern.h"
+
+void PatternThumbnails::draw(Graphics& g, Pattern& pattern, Rectangle<int> bounds)
+{
+    if (bounds.isEmpty())
+        return;
+
+    auto scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+    auto width = roundToInt(bounds.getWidth() * scale);
+    auto height = roundToInt(bounds.getHeight() * scale);
+
+    auto& entry = entries[{ getShapeHash(pattern), width, height }];
+    if (entry.image.isNull())
+        entry.image = render(pattern, width, height, scale);
+    entry.lastUsed = ++frame;
+
+    g.drawImage(entry.image, bounds.toFloat(), RectanglePlacement::stretchToFit, true);
+
+    if ((int)entries.size() > kMaxEntries || (int)hashes.size() > kMaxEntries)
+        evict();
+}
+
+uint64_t PatternThumbnails::getShapeHash(Pattern& pattern)
+{
+    // segment IDs are unique in the process, a pattern allocated at a freed address never matches
+    auto segmentsID = pattern.segmentsID.load();
+    auto& cached = hashes[&pattern];
+    if (cached.segmentsID != segmentsID) {
+        cached.hash = pattern.getShapeHash();
+        cached.segmentsID = segmentsID;
+    }
+    return cached.hash;
+}
+
+Image PatternThumbnails::render(Pattern& pattern, int width, int height, float scale)
+{
+    // the line is drawn with the stroke of the logical size, 1px wide, scaled to device pixels
+    Image image(Image::SingleChannel, width, height, true);
+    Graphics g(image);
+    g.addTransform(AffineTransform::scale(scale));
+
+    auto w = width / scale;
+    auto h = height / scale;
+    int steps = std::max(1, width);
+
+    Path path;
+    path.startNewSubPath(0.f, (float)(pattern.get_y_at(0) * h));
+    for (int i = 0; i < steps + 1; ++i) {
+        double px = double(i) / double(steps);
+        path.lineTo((float)(px * w), (float)(pattern.get_y_at(px) * h));
+    }
+
+    g.setColour(Colours::white);
+    g.strokePath(path, PathStrokeType(1.f));
+    return image;
+}
+
+void PatternThumbnails::evict()
+{
+    // drops the least recently drawn half, stale sizes and replaced patterns go first
+    std::vector<uint64> used;
+    used.reserve(entries.size());
+    for (auto& [key, entry] : entries)
+        used.push_back(entry.lastUsed);
+
+    auto mid = used.begin() + used.size() / 2;
+    std::nth_element(used.begin(), mid, used.end());
+    auto threshold = *mid;
+
+    for (auto it = entries.begin(); it != entries.end();) {
+        if (it->second.lastUsed < threshold) it = entries.erase(it);
+        else ++it;
+    }
+    hashes.clear(); // drops patterns that no longer exist, live ones hash again on their next draw
+}
@@ -0,0 +1,58 @@
+/*
+  ==============================================================================
+
+    PatternThumbnails.h
+    Author:  tiagolr
+
+    Pre-rendered pattern thumbnails shared by every editor in the process
+    Thumbnails are keyed on the pattern shape hash and pixel size, so the same
+    paint pattern drawn by several editors is rendered once
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <map>
+#include <tuple>
+#include <vector>
+
+class Pattern;
+
+class PatternThumbnails
+{
+public:
+    static constexpr int kMaxEntries = 256;
+
+    /**
+     * Draws a pattern thumbnail, message thread only
+     * Thumbnails are single channel images filled with the current colour
+     * @param g Graphics context, its physical scale sets the thumbnail resolution
+     * @param pattern Pattern to draw
+     * @param bounds Target bounds in logical pixels
+     */
+    void draw(Graphics& g, Pattern& pattern, Rectangle<int> bounds);
+
+private:
+    struct Entry {
+        Image image;
+        uint64 lastUsed = 0;
+    };
+
+    struct Hash {
+        uint64_t segmentsID = 0;
+        uint64_t hash = 0;
+    };
+
+    using Key = std::tuple<uint64_t, int, int>; // pattern shape hash, pixel width, pixel height
+
+    std::map<Key, Entry> entries;
+    std::map<const Pattern*, Hash> hashes; // shape hash of each drawn pattern, recomputed when its segments change
+    uint64 frame = 0;
+
+    uint64_t getShapeHash(Pattern& pattern);
+
+    static Image render(Pattern& pattern, int width, int height, float scale);
+    void evict();
+};
@@ -0,0 +1,202 @@
+#include "ProfilerOverlay.h"
+#include "../PluginProcessor.h"
+#include "View.h"
+
+ProfilerOverlay::ProfilerOverlay(FILTRAudioProcessor& p, View& v) : audioProcessor(p), view(v)
+{
+    auto addButton = [this](TextButton& button, String label) {
+        addAndMakeVisible(button);
+        button.setButtonText(label);
+        button.setComponentID("button");
+        button.setColour(TextButton::buttonColourId, Colour(COLOR_ACTIVE));
+        button.setColour(TextButton::textColourOffId, Colour(COLOR_ACTIVE));
+    };
+
+    addButton(pageButton, "UI");
+    pageButton.onClick = [this]() {
+        showUI = !showUI;
+        pageButton.setButtonText(showUI ? "Audio" : "UI");
+        benchButton.setVisible(showUI);
+        repaint();
+    };
+    addButton(benchButton, "Bench");
+    benchButton.setVisible(false);
+    benchButton.onClick = [this]() {
+        view.paintProfiler.runBench(view);
+        repaint();
+    };
+    addButton(resetButton, "Reset");
+    resetButton.onClick = [this]() {
+        audioProcessor.profiler.reset();
+        view.paintProfiler.reset();
+    };
+    addButton(exportButton, "CSV");
+    exportButton.onClick = [this]() { exportCSV(); };
+    addButton(closeButton, "Close");
+    closeButton.onClick = [this]() { setVisible(false); };
+}
+
+ProfilerOverlay::~ProfilerOverlay()
+{
+    audioProcessor.profiler.enabled.store(false);
+    view.paintProfiler.enabled = false;
+}
+
+void ProfilerOverlay::visibilityChanged()
+{
+    // counters only run on the audio thread while the overlay is open
+    audioProcessor.profiler.enabled.store(isVisible());
+    view.paintProfiler.enabled = isVisible();
+    if (isVisible()) {
+        audioProcessor.profiler.reset();
+        view.paintProfiler.reset();
+        startTimerHz(10);
+    }
+    else {
+        stopTimer();
+    }
+}
+
+void ProfilerOverlay::timerCallback()
+{
+    repaint();
+}
+
+void ProfilerOverlay::resized()
+{
+    auto col = getWidth() - PLUG_PADDING - 60;
+    closeButton.setBounds(col, PLUG_PADDING, 60, 25); col -= 70;
+    exportButton.setBounds(col, PLUG_PADDING, 60, 25); col -= 70;
+    resetButton.setBounds(col, PLUG_PADDING, 60, 25); col -= 70;
+    pageButton.setBounds(col, PLUG_PADDING, 60, 25); col -= 70;
+    benchButton.setBounds(col, PLUG_PADDING, 60, 25);
+}
+
+void ProfilerOverlay::paint(Graphics& g)
+{
+    g.fillAll(Colour(0xdd000000));
+
+    auto bounds = getLocalBounds().reduced(PLUG_PADDING);
+    g.setFont(FontOptions(16.f));
+    g.setColour(Colours::white);
+    g.drawText(showUI ? "View paint profile" : "Audio thread profile", bounds.removeFromTop(25), Justification::centredLeft);
+    bounds.removeFromTop(10);
+
+    if (showUI)
+        paintUI(g, bounds);
+    else
+        paintAudio(g, bounds);
+}
+
+void ProfilerOverlay::paintUI(Graphics& g, Rectangle<int> bounds)
+{
+    auto& paintProfiler = view.paintProfiler;
+    auto benchColumn = bounds.removeFromRight(220);
+    bounds.removeFromRight(20);
+    g.setFont(FontOptions(14.f));
+    g.setColour(Colour(COLOR_NEUTRAL_LIGHT));
+    auto header = bounds.removeFromTop(20);
+    g.drawText("Part", header.removeFromLeft(90), Justification::centredLeft);
+    g.drawText("Mean ms", header.removeFromLeft(70), Justification::centredRight);
+    g.drawText("Max ms", header.removeFromLeft(70), Justification::centredRight);
+
+    double total = 0.0;
+    for (int i = 0; i < PaintProfiler::kNumParts; ++i)
+        total += paintProfiler.getStats(i).meanMillis;
+
+    for (int i = 0; i < PaintProfiler::kNumParts; ++i) {
+        auto stats = paintProfiler.getStats(i);
+        auto row = bounds.removeFromTop(20);
+
+        g.setColour(Colours::white);
+        g.drawText(PaintProfiler::getPartName(i), row.removeFromLeft(90), Justification::centredLeft);
+        g.drawText(String(stats.meanMillis, 3), row.removeFromLeft(70), Justification::centredRight);
+        g.drawText(String(stats.maxMillis, 3), row.removeFromLeft(70), Justification::centredRight);
+        row.removeFromLeft(20);
+
+        // share of the frame paint time
+        auto area = row.reduced(0, 4).toFloat();
+        g.setColour(Colour(COLOR_ACTIVE));
+        if (total > 0.0)
+            g.fillRect(area.withWidth(area.getWidth() * (float)(stats.meanMillis / total)));
+    }
+
+    // offscreen bench results, right column
+    auto& results = paintProfiler.getBenchResults();
+    if (results.empty())
+        return;
+
+    g.setColour(Colour(COLOR_NEUTRAL_LIGHT));
+    g.drawText("Offscreen ms/frame", benchColumn.removeFromTop(20), Justification::centredLeft);
+    g.setColour(Colours::white);
+    for (auto& result : results) {
+        g.drawText(String(result.scale, 1) + "x " + String(result.width) + "x" + String(result.height)
+            + "  " + String(result.meanMillis, 2) + " (" + String(result.maxMillis, 2) + ")",
+            benchColumn.removeFromTop(20), Justification::centredLeft);
+    }
+}
+
+void ProfilerOverlay::paintAudio(Graphics& g, Rectangle<int> bounds)
+{
+    g.setFont(FontOptions(14.f));
+    g.setColour(Colour(COLOR_NEUTRAL_LIGHT));
+    auto header = bounds.removeFromTop(20);
+    g.drawText("Stage", header.removeFromLeft(90), Justification::centredLeft);
+    g.drawText("Mean us", header.removeFromLeft(70), Justification::centredRight);
+    g.drawText("Max us", header.removeFromLeft(70), Justification::centredRight);
+    g.drawText("Budget", header.removeFromLeft(70), Justification::centredRight);
+    header.removeFromLeft(20);
+    g.drawText("Histogram (" + Profiler::getBucketName(0) + " .. " + Profiler::getBucketName(Profiler::kNumBuckets - 1) + ")", header, Justification::centredLeft);
+
+    for (int i = 0; i < Profiler::kNumStages; ++i) {
+        auto stats = audioProcessor.profiler.getStats(i);
+        auto row = bounds.removeFromTop(22);
+
+        g.setColour(Colours::white);
+        g.drawText(Profiler::getStageName(i), row.removeFromLeft(90), Justification::centredLeft);
+        g.drawText(String(stats.meanMicros, 1), row.removeFromLeft(70), Justification::centredRight);
+        g.drawText(String(stats.maxMicros, 1), row.removeFromLeft(70), Justification::centredRight);
+        g.drawText(String(stats.budget * 100.0, 2) + "%", row.removeFromLeft(70), Justification::centredRight);
+        row.removeFromLeft(20);
+
+        // histogram bars normalized by the most populated bucket
+        uint64 peak = 0;
+        for (int j = 0; j < Profiler::kNumBuckets; ++j)
+            peak = std::max(peak, stats.buckets[j]);
+
+        auto barw = (float)row.getWidth() / Profiler::kNumBuckets;
+        auto area = row.reduced(0, 3).toFloat();
+        g.setColour(Colour(COLOR_ACTIVE));
+        for (int j = 0; j < Profiler::kNumBuckets && peak > 0; ++j) {
+            auto h = area.getHeight() * (float)((double)stats.buckets[j] / (double)peak);
+            g.fillRect(area.getX() + j * barw, area.getBottom() - h, std::max(1.f, barw - 1.f), h);
+        }
+    }
+
+    // filter stage mean per filter model, only models that processed blocks
+    String models;
+    for (int i = 0; i < Profiler::kNumModels; ++i) {
+        auto stats = audioProcessor.profiler.getModelStats(i);
+        if (stats.blocks > 0)
+            models << Profiler::getModelName(i) << " " << String(stats.meanMicros, 1) << "us   ";
+    }
+    if (models.isNotEmpty()) {
+        g.setColour(Colour(COLOR_NEUTRAL_LIGHT));
+        g.drawText("Filter models: " + models, bounds.removeFromTop(22), Justification::centredLeft);
+    }
+}
+
+void ProfilerOverlay::exportCSV()
+{
+    fileChooser.reset(new juce::FileChooser("Export profile to a file", juce::File::getSpecialLocation(juce::File::commonDocumentsDirectory), "*.csv"));
+    fileChooser->launchAsync(juce::FileBrowserComponent::saveMode |
+        juce::FileBrowserComponent::canSelectFiles |
+        juce::FileBrowserComponent::warnAboutOverwriting, [this](const juce::FileChooser& fc)
+        {
+            auto file = fc.getResult();
+            if (file == juce::File{})
+                return;
+
+            file.replaceWithText(audioProcessor.profiler.toCSV() + "\n" + view.paintProfiler.toCSV());
+        });
+}
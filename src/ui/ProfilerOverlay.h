@@ -0,0 +1,46 @@
+/*
+  ==============================================================================
+
+    ProfilerOverlay.h
+    Author:  tiagolr
+
+    Shows the audio thread per stage timing histograms over the view
+    and the view paint timings on a second page
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "../Globals.h"
+
+using namespace globals;
+class FILTRAudioProcessor;
+class View;
+
+class ProfilerOverlay : public juce::Component, private juce::Timer
+{
+public:
+    ProfilerOverlay(FILTRAudioProcessor& p, View& v);
+    ~ProfilerOverlay() override;
+
+    void timerCallback() override;
+    void visibilityChanged() override;
+    void resized() override;
+    void paint(Graphics& g) override;
+    void exportCSV();
+    void paintAudio(Graphics& g, Rectangle<int> bounds);
+    void paintUI(Graphics& g, Rectangle<int> bounds);
+
+private:
+    FILTRAudioProcessor& audioProcessor;
+    View& view;
+    bool showUI = false;
+    TextButton pageButton;
+    TextButton benchButton;
+    TextButton resetButton;
+    TextButton exportButton;
+    TextButton closeButton;
+    std::unique_ptr<juce::FileChooser> fileChooser;
+};
@@ -422,6 +422,7 @@ void Sequencer::open()
 void Sequencer::close()
 {
     isOpen = false;
+    builtPattern = nullptr;
     auto currpat = getCurrentPattern();
     if (currpat->index != patternIdx)
         return;
@@ -476,24 +477,105 @@ void Sequencer::apply()
 
 void Sequencer::build()
 {
-    pat->clear();
+    // range of the point list written by this build, the old range had delta fewer points
+    bool changed = false;
+    size_t first = 0;
+    size_t last = 0;
+    ptrdiff_t delta = 0;
+    bool spliced = compiled.size() == cells.size();
+
+    if (!spliced) {
+        // cells were added or removed, rebuild the point list reusing cells that did not change
+        std::vector<CompiledCell> next(cells.size());
+        compiledPoints.clear();
+        for (size_t i = 0; i < cells.size(); ++i) {
+            if (i < compiled.size() && isCompiled(compiled[i], cells[i]))
+                next[i] = std::move(compiled[i]);
+            else
+                compileCell(next[i], cells[i]);
+            compiledPoints.insert(compiledPoints.end(), next[i].points.begin(), next[i].points.end());
+        }
+        compiled = std::move(next);
+    }
+    else {
+        // splice the points of dirty cells into the point list
+        size_t offset = 0;
+        for (size_t i = 0; i < cells.size(); ++i) {
+            auto& compiledCell = compiled[i];
+            auto count = compiledCell.points.size();
+            if (!isCompiled(compiledCell, cells[i])) {
+                compileCell(compiledCell, cells[i]);
+                auto it = compiledPoints.erase(compiledPoints.begin() + offset, compiledPoints.begin() + offset + count);
+                compiledPoints.insert(it, compiledCell.points.begin(), compiledCell.points.end());
+                delta += (ptrdiff_t)compiledCell.points.size() - (ptrdiff_t)count;
+                count = compiledCell.points.size();
+                if (!changed)
+                    first = offset;
+                last = offset + count;
+                changed = true;
+            }
+            offset += count;
+        }
+    }
 
-    for (auto& cell : cells) {
-        auto seg = buildSeg(cell);
-        for (auto& pt : seg) {
-            auto x = pt.x;
-            if (x < 0.0) x += 1.0;
-            if (x > 1.0) x -= 1.0;
-            pat->insertPoint(x, pt.y, pt.tension, pt.type, false);
+    auto byX = [](const PPoint& a, const PPoint& b) { return a.x < b.x; };
+    auto currpat = getCurrentPattern();
+
+    // dragging a cell patches only its points into the patterns when the point list
+    // stays sorted and the current pattern still holds the last built points
+    bool patch = spliced && compiledSorted && currpat == builtPattern
+        && (ptrdiff_t)currpat->points.size() == (ptrdiff_t)compiledPoints.size() - delta;
+    if (patch && changed) {
+        auto begin = compiledPoints.begin() + (first > 0 ? first - 1 : 0);
+        auto end = compiledPoints.begin() + std::min(last + 1, compiledPoints.size());
+        patch = std::is_sorted(begin, end, byX);
+    }
+
+    if (patch) {
+        if (!changed)
+            return;
+
+        auto src = compiledPoints.begin() + first;
+        for (auto* p : { pat, currpat }) {
+            auto it = p->points.erase(p->points.begin() + first, p->points.begin() + ((ptrdiff_t)last - delta));
+            p->points.insert(it, src, src + (last - first));
         }
+        currpat->updateSegments(first, last);
+        return;
     }
 
-    pat->sortPoints();
+    pat->points = compiledPoints;
+    compiledSorted = std::is_sorted(pat->points.begin(), pat->points.end(), byX);
+    if (!compiledSorted)
+        pat->sortPoints();
+
     //pat->points = removeCollinearPoints(pat->points);
-    auto currpat = getCurrentPattern();
     currpat->points = pat->points;
-    currpat->sortPoints();
     currpat->buildSegments();
+    builtPattern = currpat;
+}
+
+bool Sequencer::isCompiled(const CompiledCell& compiledCell, const Cell& cell)
+{
+    if (!compareCell(compiledCell.cell, cell))
+        return false;
+    return cell.shape != SPTool || Pattern::comparePoints(compiledCell.paint, audioProcessor.getPaintPatern(cell.ptool)->points);
+}
+
+void Sequencer::compileCell(CompiledCell& compiledCell, const Cell& cell)
+{
+    compiledCell.cell = cell;
+    compiledCell.paint.clear();
+    if (cell.shape == SPTool)
+        compiledCell.paint = audioProcessor.getPaintPatern(cell.ptool)->points;
+
+    compiledCell.points = buildSeg(cell);
+    auto id = Pattern::newPointIDs(compiledCell.points.size());
+    for (auto& pt : compiledCell.points) {
+        if (pt.x < 0.0) pt.x += 1.0;
+        if (pt.x > 1.0) pt.x -= 1.0;
+        pt.id = id++;
+    }
 }
 
 /*
@@ -687,15 +769,21 @@ bool Sequencer::isSnapping(const MouseEvent& e) {
 
 //=====================================================================
 
-void Sequencer::createUndo(std::vector<Cell> snap)
+void Sequencer::setUndoBudget(UndoBudget* budget)
+{
+    undoStack.setBudget(budget);
+    redoStack.setBudget(budget);
+}
+
+void Sequencer::createUndo(const std::vector<Cell>& snap)
 {
     if (compareCells(snap, cells)) {
         return; // nothing to undo
     }
     if (undoStack.size() > globals::MAX_UNDO) {
-        undoStack.erase(undoStack.begin());
+        undoStack.dropOldest();
     }
-    undoStack.push_back(snap);
+    undoStack.push(snap);
     redoStack.clear();
     MessageManager::callAsync([this]() { audioProcessor.sendChangeMessage(); }); // repaint undo/redo buttons
 }
@@ -704,9 +792,8 @@ void Sequencer::undo()
     if (undoStack.empty())
         return;
 
-    redoStack.push_back(cells);
-    cells = undoStack.back();
-    undoStack.pop_back();
+    redoStack.push(cells);
+    cells = undoStack.pop();
 
     build();
     MessageManager::callAsync([this]() {
@@ -719,9 +806,8 @@ void Sequencer::redo()
     if (redoStack.empty())
         return;
 
-    undoStack.push_back(cells);
-    cells = redoStack.back();
-    redoStack.pop_back();
+    undoStack.push(cells);
+    cells = redoStack.pop();
 
     build();
     MessageManager::callAsync([this]() {
@@ -742,19 +828,28 @@ bool Sequencer::compareCells(const std::vector<Cell>& a, const std::vector<Cell>
 {
     if (a.size() != b.size()) return false;
     for (size_t i = 0; i < a.size(); ++i) {
-        if (a[i].invertx != b[i].invertx ||
-            a[i].minx != b[i].minx ||
-            a[i].maxx != b[i].maxx ||
-            a[i].maxy != b[i].maxy ||
-            a[i].miny != b[i].miny ||
-            a[i].shape != b[i].shape ||
-            a[i].tenatt != b[i].tenatt ||
-            a[i].tenrel != b[i].tenrel ||
-            a[i].ptool != b[i].ptool ||
-            a[i].skew != b[i].skew
-        ) {
+        if (!compareCell(a[i], b[i])) {
             return false;
         }
     }
     return true;
-}
\ No newline at end of file
+}
+
+bool Sequencer::compareCell(const Cell& a, const Cell& b)
+{
+    return CellEqual()(a, b);
+}
+
+bool CellEqual::operator()(const Cell& a, const Cell& b) const
+{
+    return a.invertx == b.invertx &&
+        a.minx == b.minx &&
+        a.maxx == b.maxx &&
+        a.maxy == b.maxy &&
+        a.miny == b.miny &&
+        a.shape == b.shape &&
+        a.tenatt == b.tenatt &&
+        a.tenrel == b.tenrel &&
+        a.ptool == b.ptool &&
+        a.skew == b.skew;
+}
@@ -45,6 +45,17 @@ struct Cell {
     double skew;
 };
 
+struct CellEqual {
+    bool operator()(const Cell& a, const Cell& b) const;
+};
+
+// cell points from the last build, cells that did not change since are not rebuilt
+struct CompiledCell {
+    Cell cell;
+    std::vector<PPoint> paint; // source paint points of SPTool cells
+    std::vector<PPoint> points;
+};
+
 class Sequencer {
 public:
     bool isOpen = false;
@@ -91,10 +102,11 @@ public:
     void randomize(SeqEditMode mode, double min, double max);
     void clear(SeqEditMode mode);
 
-    std::vector<std::vector<Cell>> undoStack;
-    std::vector<std::vector<Cell>> redoStack;
+    UndoStack<Cell, CellEqual> undoStack;
+    UndoStack<Cell, CellEqual> redoStack;
+    void setUndoBudget(UndoBudget* budget);
     void clearUndo();
-    void createUndo(std::vector<Cell> snapshot);
+    void createUndo(const std::vector<Cell>& snapshot);
     void undo();
     void redo();
 
@@ -109,6 +121,10 @@ private:
     std::vector<PPoint> sine;
 
     std::vector<Cell> snapshot;
+    std::vector<CompiledCell> compiled; // one entry per cell, same order as cells
+    std::vector<PPoint> compiledPoints; // compiled cells points concatenated in cells order
+    bool compiledSorted = false; // compiledPoints were already sorted on the last full build
+    Pattern* builtPattern = nullptr; // pattern that received the last full build, later builds patch it
     Pattern* pat;
     Pattern* tmp; // temp pattern used for painting
     int winx = 0;
@@ -120,4 +136,7 @@ private:
     bool isSnapping(const MouseEvent& e);
     std::vector<PPoint> removeCollinearPoints(std::vector<PPoint>& pts);
     bool compareCells(const std::vector<Cell>& a, const std::vector<Cell>& b);
+    static bool compareCell(const Cell& a, const Cell& b);
+    bool isCompiled(const CompiledCell& compiledCell, const Cell& cell);
+    void compileCell(CompiledCell& compiledCell, const Cell& cell);
 };
\ No newline at end of file
@@ -73,6 +73,23 @@ void SettingsButton::mouseDown(const juce::MouseEvent& e)
 		audioOutputMIDI.addItem(500+i, midiNoteToName(i-1), true, audioProcessor.outputATMIDI == i);
 	}
 
+	PopupMenu CCMode;
+	CCMode.addItem(710, "7-bit", true, audioProcessor.outputCCMode == 0);
+	CCMode.addItem(711, "14-bit (CC 0-31)", true, audioProcessor.outputCCMode == 1);
+	CCMode.addItem(712, "NRPN", true, audioProcessor.outputCCMode == 2);
+
+	PopupMenu CCRate;
+	static const int ccRates[] = { 0, 10, 5, 2, 1 };
+	for (int i = 0; i < 5; ++i) {
+		CCRate.addItem(720 + i, ccRates[i] == 0 ? "Block" : String(ccRates[i]) + " ms", true, audioProcessor.outputCCRate == ccRates[i]);
+	}
+
+	PopupMenu CCDeadband;
+	static const double ccDeadbands[] = { 0.0, 0.001, 0.005, 0.01 };
+	for (int i = 0; i < 4; ++i) {
+		CCDeadband.addItem(730 + i, ccDeadbands[i] == 0.0 ? "Off" : String(ccDeadbands[i] * 100.0, 1) + "%", true, audioProcessor.outputCCDeadband == ccDeadbands[i]);
+	}
+
 	PopupMenu output;
 	output.addItem(700, "CV", true, audioProcessor.outputCV);
 	output.addSubMenu("CC", CC);
@@ -80,6 +97,9 @@ void SettingsButton::mouseDown(const juce::MouseEvent& e)
 	output.addSubMenu("Audio Trig. MIDI", audioOutputMIDI);
 	output.addSeparator();
 	output.addItem(701, "Bipolar CC", true, audioProcessor.bipolarCC);
+	output.addSubMenu("CC Mode", CCMode);
+	output.addSubMenu("CC Rate", CCRate);
+	output.addSubMenu("CC Deadband", CCDeadband);
 
 	PopupMenu lerp;
 	auto value = audioProcessor.params.getRawParameterValue("flerp")->load();
@@ -88,8 +108,72 @@ void SettingsButton::mouseDown(const juce::MouseEvent& e)
 	lerp.addItem(802, "High", true, value == 1.0f);
 
 
+	// modulation matrix, ids are 3000 + source * 100 + dest * 10 + depth index
+	PopupMenu modulation;
+	for (int src = 0; src < ModBus::kNumSources; ++src) {
+		PopupMenu source;
+		for (int dst = 0; dst < ModBus::kNumDests; ++dst) {
+			if (ModBus::isBuiltin(src, dst)) {
+				source.addItem(3000 + src * 100 + dst * 10 + 9, String(ModBus::getDestName(dst)) + " (built-in)", false, true);
+				continue;
+			}
+			PopupMenu dest;
+			auto depth = audioProcessor.modbus.getDepth(src, dst);
+			for (int i = 0; i < ModBus::kNumDepths; ++i) {
+				auto label = i == 0 ? String("Off") : String(ModBus::kDepths[i] > 0 ? "+" : "") + String((int)(ModBus::kDepths[i] * 100)) + "%";
+				dest.addItem(3000 + src * 100 + dst * 10 + i, label, true, depth == ModBus::kDepths[i]);
+			}
+			source.addSubMenu(ModBus::getDestName(dst), dest, true, nullptr, depth != 0.0);
+		}
+		modulation.addSubMenu(ModBus::getSourceName(src), source);
+	}
+
+	PopupMenu capture;
+	bool canCapture = audioProcessor.uimode != UIMode::Seq && audioProcessor.uimode != UIMode::PaintEdit;
+	capture.addItem(900, "Capture cycle from cut env", canCapture);
+	capture.addItem(901, "Capture cycle from sidechain", canCapture);
+	capture.addItem(902, "Stop capture", audioProcessor.capture.isActive());
+	capture.addSeparator();
+	capture.addItem(903, "Continuous", true, audioProcessor.captureContinuous);
+	static const double captureTolerances[] = { 0.005, 0.01, 0.02, 0.05 };
+	for (int i = 0; i < 4; ++i) {
+		capture.addItem(910 + i, "Tolerance " + String(captureTolerances[i] * 100.0, 1) + "%", true, audioProcessor.capture.tolerance.load() == captureTolerances[i]);
+	}
+
+	// multiband, ids are 1100 + bands, 1110 + split * 20 + freq, 1200 + band * 20 + type and 1300 + band * 20 + pattern
+	static const double crossoverFreqs[] = { 80.0, 150.0, 250.0, 400.0, 600.0, 1000.0, 1500.0, 2500.0, 4000.0, 6000.0, 10000.0 };
+	static const char* filterNames[] = { "Linear 12", "Linear 24", "Analog 12", "Analog 24", "Moog 12", "Moog 24", "MS-20", "303", "Phaser +", "Phaser -" };
+	int multibands = audioProcessor.multibands;
+	PopupMenu multiband;
+	multiband.addItem(1100, "Off", true, multibands == 0);
+	for (int bands = 2; bands <= Crossover::kMaxBands; ++bands)
+		multiband.addItem(1100 + bands, String(bands) + " bands", true, multibands == bands);
+	multiband.addSeparator();
+	for (int split = 0; split < Crossover::kMaxBands - 1; ++split) {
+		PopupMenu freqs;
+		for (int i = 0; i < 11; ++i) {
+			auto freq = crossoverFreqs[i];
+			freqs.addItem(1110 + split * 20 + i, freq >= 1000.0 ? String(freq / 1000.0, 1) + " kHz" : String((int)freq) + " Hz",
+				true, audioProcessor.crossoverFreqs[split] == freq);
+		}
+		multiband.addSubMenu("Crossover " + String(split + 1), freqs, split + 1 < multibands);
+	}
+	multiband.addSeparator();
+	for (int band = 0; band < Crossover::kMaxBands - 1; ++band) {
+		PopupMenu bandMenu;
+		for (int type = 0; type < 10; ++type)
+			bandMenu.addItem(1200 + band * 20 + type, filterNames[type], true, audioProcessor.bandFilterTypes[band] == type);
+		bandMenu.addSeparator();
+		for (int pat = 0; pat < 12; ++pat)
+			bandMenu.addItem(1300 + band * 20 + pat, "Pattern " + String(pat + 1), true, audioProcessor.bandPatterns[band] == pat);
+		multiband.addSubMenu("Band " + String(band + 2), bandMenu, band + 2 <= multibands);
+	}
+
 	PopupMenu options;
 	options.addSubMenu("Filter lerp", lerp);
+	options.addSubMenu("Multiband", multiband);
+	options.addSubMenu("Capture", capture);
+	options.addSubMenu("Modulation", modulation);
 	options.addSubMenu("Output", output);
 	options.addSubMenu("MIDI trigger chn", midiTriggerChn);
 	options.addSubMenu("Cut trigger chn", triggerChn);
@@ -98,6 +182,8 @@ void SettingsButton::mouseDown(const juce::MouseEvent& e)
 	options.addSeparator();
 	options.addItem(30, "Dual smooth", true, audioProcessor.dualSmooth);
 	options.addItem(31, "Dual tension", true, audioProcessor.dualTension);
+	options.addItem(33, "Auto quality", true, audioProcessor.autoQuality);
+	options.addItem(34, "Show profiler", true, audioProcessor.profiler.enabled.load());
 
 
 	PopupMenu load;
@@ -165,6 +251,7 @@ void SettingsButton::mouseDown(const juce::MouseEvent& e)
 	load.addSeparator();
 	load.addItem(1001, "Import Pats");
 	load.addItem(1002, "Export Pats");
+	load.addItem(1003, "Library", audioProcessor.uimode != UIMode::Seq);
 	load.addSubMenu("Other", loadOther);
 
 
@@ -201,6 +288,7 @@ void SettingsButton::mouseDown(const juce::MouseEvent& e)
 			}
 			else if (result == 30) { // Dual smooth
 				audioProcessor.dualSmooth = !audioProcessor.dualSmooth;
+				audioProcessor.markDirty(FILTRAudioProcessor::DirtySmooth);
 				toggleUIComponents();
 			}
 			else if (result == 31) { // Dual tension
@@ -215,6 +303,14 @@ void SettingsButton::mouseDown(const juce::MouseEvent& e)
 					audioProcessor.audioIgnoreHitsWhilePlaying = !audioProcessor.audioIgnoreHitsWhilePlaying;
 				});
 			}
+			else if (result == 33) { // Auto quality
+				audioProcessor.autoQuality = !audioProcessor.autoQuality;
+				if (!audioProcessor.autoQuality)
+					audioProcessor.governor.reset();
+			}
+			else if (result == 34) {
+				toggleProfiler();
+			}
 			else if (result == 52) {
 				if (audioProcessor.uimode == UIMode::Seq) {
 					auto snap = audioProcessor.sequencer->cells;
@@ -305,12 +401,55 @@ void SettingsButton::mouseDown(const juce::MouseEvent& e)
 			else if (result == 701) {
 				audioProcessor.bipolarCC = !audioProcessor.bipolarCC;
 			}
+			else if (result == 900 || result == 901) {
+				audioProcessor.capture.arm(result == 900 ? PatternCapture::CutEnv : PatternCapture::Sidechain, audioProcessor.captureContinuous);
+			}
+			else if (result == 902) {
+				audioProcessor.capture.stop();
+			}
+			else if (result == 903) {
+				audioProcessor.captureContinuous = !audioProcessor.captureContinuous;
+			}
+			else if (result >= 910 && result <= 913) {
+				audioProcessor.capture.tolerance.store(captureTolerances[result - 910]);
+			}
+			else if (result >= 710 && result <= 712) {
+				audioProcessor.outputCCMode = result - 710;
+			}
+			else if (result >= 720 && result <= 724) {
+				audioProcessor.outputCCRate = ccRates[result - 720];
+			}
+			else if (result >= 730 && result <= 733) {
+				audioProcessor.outputCCDeadband = ccDeadbands[result - 730];
+			}
+			else if (result >= 3000 && result < 3000 + ModBus::kNumSources * 100) { // modulation matrix
+				int src = (result - 3000) / 100;
+				int dst = (result - 3000) % 100 / 10;
+				int depth = (result - 3000) % 10;
+				audioProcessor.modbus.setDepth(src, dst, ModBus::kDepths[depth]);
+			}
 			else if (result >= 800 && result <= 802) {
 				auto lerp = result == 800 ? 0.f
 					: result == 801 ? 0.5f
 					: 1.0f;
 				audioProcessor.params.getParameter("flerp")->setValueNotifyingHost(lerp);
 			}
+			else if (result == 1100 || (result >= 1102 && result <= 1100 + Crossover::kMaxBands)) { // multiband bands
+				audioProcessor.multibands = result - 1100;
+				audioProcessor.markDirty(FILTRAudioProcessor::DirtyMultiband);
+			}
+			else if (result >= 1110 && result < 1110 + (Crossover::kMaxBands - 1) * 20) { // crossover frequency
+				audioProcessor.crossoverFreqs[(result - 1110) / 20] = crossoverFreqs[(result - 1110) % 20];
+				audioProcessor.markDirty(FILTRAudioProcessor::DirtyMultiband);
+			}
+			else if (result >= 1200 && result < 1200 + (Crossover::kMaxBands - 1) * 20) { // band filter type
+				audioProcessor.bandFilterTypes[(result - 1200) / 20] = (result - 1200) % 20;
+				audioProcessor.markDirty(FILTRAudioProcessor::DirtyMultiband);
+			}
+			else if (result >= 1300 && result < 1300 + (Crossover::kMaxBands - 1) * 20) { // band pattern
+				audioProcessor.bandPatterns[(result - 1300) / 20] = (result - 1300) % 20;
+				audioProcessor.markDirty(FILTRAudioProcessor::DirtyMultiband);
+			}
 			else if (result == 1000) {
 				toggleAbout();
 			}
@@ -324,6 +463,9 @@ void SettingsButton::mouseDown(const juce::MouseEvent& e)
 					audioProcessor.exportPatterns();
 				});
 			}
+			else if (result == 1003) {
+				toggleLibrary();
+			}
 		}
 	);
 };
@@ -16,6 +16,8 @@ public:
     std::function<void()> onScaleChange;
     std::function<void()> toggleUIComponents;
     std::function<void()> toggleAbout;
+    std::function<void()> toggleProfiler;
+    std::function<void()> toggleLibrary;
 
 private:
     FILTRAudioProcessor& audioProcessor;
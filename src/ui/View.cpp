@@ -23,6 +23,7 @@ View::~View()
 
 void View::timerCallback()
 {
+    audioProcessor.applyPaintTension();
     if (patternID != audioProcessor.viewPattern->versionID || audioProcessor.uimode != luimode) {
         if (audioProcessor.uimode != luimode)
             multiSelect.clearSelection();
@@ -68,6 +69,13 @@ void View::resized()
 }
 
 void View::paint(Graphics& g) {
+    // laps are cheap, the profiler only keeps the timings while the overlay is open
+    bool profiling = paintProfiler.enabled;
+    auto lap = [this, profiling](PaintProfiler::Part part) {
+        if (profiling) paintProfiler.lap(part);
+    };
+    if (profiling) paintProfiler.begin();
+
     g.setColour(Colour(COLOR_BG));
     g.fillRect(winx,winy,winw,winh);
     auto uimode = audioProcessor.uimode;
@@ -78,27 +86,34 @@ void View::paint(Graphics& g) {
     g.setColour(Colours::black.withAlpha(0.2f));
     g.fillRect(winx + winw/4, winy, winw/4, winh);
     g.fillRect(winx + winw - winw/4, winy, winw/4, winh);
+    lap(PaintProfiler::Background);
 
     if (uimode == UIMode::Seq && isMouseOver())
         audioProcessor.sequencer->drawBackground(g);
+    lap(PaintProfiler::Sequencer);
 
     if (uimode == UIMode::Normal || uimode == UIMode::Seq) {
         drawWave(g, audioProcessor.preSamples, Colour(0xff7f7f7f));
         drawWave(g, audioProcessor.postSamples, Colour(COLOR_ACTIVE));
     }
+    lap(PaintProfiler::Wave);
 
     drawGrid(g);
+    lap(PaintProfiler::Grid);
     multiSelect.drawBackground(g);
+    lap(PaintProfiler::Overlays);
 
     if (uimode != UIMode::PaintEdit) {
         drawSegments(g, false);
     }
     drawSegments(g, true);
+    lap(PaintProfiler::Segments);
 
     if (uimode == UIMode::Normal || uimode == UIMode::PaintEdit) {
         drawMidPoints(g);
         drawPoints(g);
     }
+    lap(PaintProfiler::Points);
 
     if (uimode == UIMode::Paint && (isMouseOver() || paintTool.dragging)) {
         paintTool.draw(g);
@@ -106,13 +121,18 @@ void View::paint(Graphics& g) {
 
     drawPreSelection(g);
     multiSelect.draw(g);
+    lap(PaintProfiler::Overlays);
 
     if (uimode != UIMode::PaintEdit) {
         drawSeek(g);
     }
+    lap(PaintProfiler::Background);
 
     if (uimode == UIMode::Seq)
         audioProcessor.sequencer->draw(g);
+    lap(PaintProfiler::Sequencer);
+
+    if (profiling) paintProfiler.end();
 }
 
 void View::drawWave(Graphics& g, std::vector<double>& samples, Colour color) const
@@ -380,7 +400,7 @@ int View::getHoveredMidpoint(int x, int y)
 // Midpoint index is derived from segment nu
 // there is an extra segment before the first point
 // so the matching pattern point to each midpoint is midpoint - 1
-PPoint& View::getPointFromMidpoint(int midpoint)
+int View::getPointIndexFromMidpoint(int midpoint)
 {
     auto size = (int)audioProcessor.viewPattern->points.size();
     auto index = midpoint == 0 ? size - 1 : midpoint - 1;
@@ -388,7 +408,30 @@ PPoint& View::getPointFromMidpoint(int midpoint)
     if (index >= size)
         index -= size;
 
-    return audioProcessor.viewPattern->points[index];
+    return index;
+}
+
+PPoint& View::getPointFromMidpoint(int midpoint)
+{
+    return audioProcessor.viewPattern->points[getPointIndexFromMidpoint(midpoint)];
+}
+
+/*
+    Edits between mouse down and mouse up are one undo step, double clicks
+    create their own undo point and the following mouse up no longer repeats it
+*/
+void View::beginUndoGesture()
+{
+    endUndoGesture();
+    gesturePattern = audioProcessor.viewPattern;
+    gesturePattern->beginGesture();
+}
+
+void View::endUndoGesture()
+{
+    if (gesturePattern != nullptr)
+        gesturePattern->endGesture();
+    gesturePattern = nullptr;
 }
 
 void View::mouseDown(const juce::MouseEvent& e)
@@ -403,6 +446,8 @@ void View::mouseDown(const juce::MouseEvent& e)
         return;
     }
 
+    beginUndoGesture();
+
     // save snapshon, compare with changes after mouseup
     // if changes were made save this snapshot as undo
     snapshot = audioProcessor.viewPattern->points; 
@@ -461,6 +506,9 @@ void View::mouseDown(const juce::MouseEvent& e)
 
 void View::mouseUp(const juce::MouseEvent& e)
 {
+    // the gesture closes after this handler, its undo point is still part of it
+    struct GestureEnd { View& view; ~GestureEnd() { view.endUndoGesture(); } } gestureEnd { *this };
+
     setMouseCursor(MouseCursor::NormalCursor);
     e.source.enableUnboundedMouseMovement(false);
 
@@ -623,7 +671,7 @@ void View::mouseDrag(const juce::MouseEvent& e)
             auto& prev = points[static_cast<size_t>(selectedPoint) - 1];
             if (point.x <= prev.x) point.x = prev.x + 1e-8;
         }
-        audioProcessor.viewPattern->buildSegments();
+        audioProcessor.viewPattern->updateSegments({ (size_t)selectedPoint });
         audioProcessor.updateCutoffFromPattern();
         audioProcessor.updateResFromPattern();
     }
@@ -637,7 +685,7 @@ void View::mouseDrag(const juce::MouseEvent& e)
         if (tension > 1) tension = 1;
         if (tension < -1) tension = -1;
         mpoint.tension = tension;
-        audioProcessor.viewPattern->buildSegments();
+        audioProcessor.viewPattern->updateSegments({ (size_t)getPointIndexFromMidpoint(selectedMidpoint) });
     }
 
     else if (preSelectionStart.x > -1) {
@@ -764,6 +812,12 @@ bool View::keyPressed(const juce::KeyPress& key)
     return Component::keyPressed(key);
 }
 
+void View::setSelectAll(bool all)
+{
+    if (all) multiSelect.selectAll();
+    else multiSelect.clearSelection();
+}
+
 // Just in case reset the mouse active points
 // trying to fix crashes, points should be using point ids instead
 void View::mouseExit(const MouseEvent& event)
@@ -15,6 +15,7 @@
 #include "../dsp/Pattern.h"
 #include "Multiselect.h"
 #include "PaintTool.h"
+#include "PaintProfiler.h"
 
 class FILTRAudioProcessor;
 using namespace globals;
@@ -26,6 +27,7 @@ public:
     int winy = 0;
     int winw = 0;
     int winh = 0;
+    PaintProfiler paintProfiler; // paint timings shown by the profiler overlay
 
     View(FILTRAudioProcessor&);
     ~View() override;
@@ -43,6 +45,7 @@ public:
     std::vector<double> getMidpointXY(Segment seg);
     int getHoveredPoint(int x, int y);
     int getHoveredMidpoint(int x, int y);
+    int getPointIndexFromMidpoint(int midpoint);
     PPoint& getPointFromMidpoint(int midpoint);
 
     // events
@@ -55,6 +58,7 @@ public:
     void mouseExit (const MouseEvent& event) override;
     bool keyPressed(const juce::KeyPress& key) override;
     void insertNewPoint(const MouseEvent& event);
+    void setSelectAll(bool all); // selects every point like the context menu, or clears the selection
 
     void showPointContextMenu(const juce::MouseEvent& event);
     void showContextMenu(const MouseEvent& e);
@@ -76,6 +80,7 @@ private:
     int dragStartY = 0; // used for midpoint dragging
     uint64_t patternID = 0; // used to detect pattern changes
     std::vector<PPoint> snapshot; // used for undo after drag
+    Pattern* gesturePattern = nullptr; // pattern with an open undo gesture, from mouse down to mouse up
     int snapshotIdx = 0; // used for undo after drag
 
     // Multiselect
@@ -86,6 +91,9 @@ private:
     // PaintTool
     PaintTool paintTool;
 
+    void beginUndoGesture();
+    void endUndoGesture();
+
     // Draw seek trail
     std::deque<Point<double>> seekTrail;
 };
\ No newline at end of file
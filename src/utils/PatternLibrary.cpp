@@ -0,0 +1,306 @@
+#include "PatternLibrary.h"
+#include "../PluginProcessor.h"
+#include <map>
+
+constexpr int PATTERN_LINES{ 24 };
+
+PatternLibrary::PatternLibrary()
+{
+}
+
+PatternLibrary::~PatternLibrary()
+{
+	generation->fetch_add(1); // stops running scans at the next file, they only hold the shared counter
+	unmap();
+}
+
+void PatternLibrary::setFolder(const juce::File& f)
+{
+	if (f == folder) {
+		rescan();
+		return;
+	}
+
+	generation->fetch_add(1);
+	scanning.store(false);
+	folder = f;
+	remap();
+	sendChangeMessage();
+	rescan();
+}
+
+void PatternLibrary::rescan()
+{
+	if (!folder.isDirectory() || scanning.load())
+		return;
+
+	scanning.store(true);
+	auto gen = generation->load();
+	auto counter = generation;
+	auto dir = folder;
+	juce::WeakReference<PatternLibrary> weakThis(this);
+
+	pool->pool.addJob([weakThis, counter, gen, dir] {
+		auto indexFile = dir.getChildFile(indexFileName);
+		auto result = scanFolder(dir, readIndex(indexFile), *counter, gen);
+		if (counter->load() != gen)
+			return;
+
+		// write the new index next to the current one, it is swapped in on the message thread
+		// where the current index is unmapped first, replacing a mapped file fails on some systems
+		// the name is unique so instances scanning the same folder never share a temporary file
+		auto tmp = dir.getChildFile(juce::String(indexFileName) + "." + juce::Uuid().toString() + ".tmp");
+		bool written = false;
+		{
+			Header header = {};
+			std::memcpy(header.magic, "FILTRLIB", 8);
+			header.version = kVersion;
+			header.entrySize = (juce::int32)sizeof(Entry);
+			header.numEntries = (juce::int64)result.size();
+
+			juce::FileOutputStream out(tmp);
+			if (out.openedOk()) {
+				out.setPosition(0);
+				out.truncate();
+				written = out.write(&header, sizeof(Header))
+					&& (result.empty() || out.write(result.data(), result.size() * sizeof(Entry)));
+				out.flush();
+				written = written && out.getStatus().wasOk();
+			}
+		}
+
+		juce::MessageManager::callAsync([weakThis, gen, tmp, written, memory = written ? std::vector<Entry>() : std::move(result)]() mutable {
+			auto* lib = weakThis.get();
+			if (lib == nullptr || lib->generation->load() != gen) {
+				tmp.deleteFile();
+				return;
+			}
+
+			lib->unmap();
+			if (written && tmp.moveFileTo(lib->folder.getChildFile(indexFileName))) {
+				lib->remap();
+			}
+			else {
+				// read only folder, keep the index in memory for this session
+				tmp.deleteFile();
+				lib->memEntries = std::move(memory);
+				lib->entries = lib->memEntries.data();
+				lib->numEntries = (int)lib->memEntries.size();
+			}
+			lib->scanning.store(false);
+			lib->sendChangeMessage();
+		});
+	});
+}
+
+int PatternLibrary::getNumEntries() const
+{
+	return numEntries;
+}
+
+const PatternLibrary::Entry* PatternLibrary::getEntry(int index) const
+{
+	return index >= 0 && index < numEntries ? entries + index : nullptr;
+}
+
+std::vector<int> PatternLibrary::search(const juce::String& query) const
+{
+	auto words = juce::StringArray::fromTokens(query.toLowerCase(), " ", "\"");
+	words.removeEmptyStrings();
+
+	std::vector<int> result;
+	result.reserve((size_t)numEntries);
+	for (int i = 0; i < numEntries; ++i) {
+		if (words.isEmpty()) {
+			result.push_back(i);
+			continue;
+		}
+
+		auto& e = entries[i];
+		auto text = juce::String::fromUTF8(e.file, (int)strnlen(e.file, kFileSize)).toLowerCase()
+			+ " " + juce::String::fromUTF8(e.tags, (int)strnlen(e.tags, kTagsSize));
+
+		bool match = true;
+		for (auto& word : words) {
+			if (!text.contains(word)) {
+				match = false;
+				break;
+			}
+		}
+		if (match)
+			result.push_back(i);
+	}
+	return result;
+}
+
+void PatternLibrary::loadPoints(int index, std::function<void(std::vector<PPoint>)> callback)
+{
+	auto* entry = getEntry(index);
+	if (entry == nullptr)
+		return;
+
+	auto file = folder.getChildFile(juce::String::fromUTF8(entry->file, (int)strnlen(entry->file, kFileSize)));
+	auto line = (int)entry->line;
+	pool->pool.addJob([file, line, callback] {
+		auto points = FILTRAudioProcessor::parsePoints(readLine(file, line));
+		juce::MessageManager::callAsync([callback, points] { callback(points); });
+	});
+}
+
+void PatternLibrary::remap()
+{
+	unmap();
+	auto indexFile = folder.getChildFile(indexFileName);
+	if (!indexFile.existsAsFile())
+		return;
+
+	mapped = std::make_unique<juce::MemoryMappedFile>(indexFile, juce::MemoryMappedFile::readOnly);
+	auto* data = static_cast<const char*>(mapped->getData());
+	auto size = mapped->getSize();
+	if (data == nullptr || size < sizeof(Header)) {
+		mapped.reset();
+		return;
+	}
+
+	Header header;
+	std::memcpy(&header, data, sizeof(Header));
+	if (std::memcmp(header.magic, "FILTRLIB", 8) != 0
+		|| header.version != kVersion
+		|| header.entrySize != (juce::int32)sizeof(Entry)
+		|| header.numEntries < 0
+		|| size < sizeof(Header) + (size_t)header.numEntries * sizeof(Entry))
+	{
+		mapped.reset();
+		return;
+	}
+
+	entries = reinterpret_cast<const Entry*>(data + sizeof(Header));
+	numEntries = (int)header.numEntries;
+}
+
+void PatternLibrary::unmap()
+{
+	entries = nullptr;
+	numEntries = 0;
+	mapped.reset();
+	memEntries.clear();
+}
+
+std::vector<PatternLibrary::Entry> PatternLibrary::readIndex(const juce::File& indexFile)
+{
+	std::vector<Entry> result;
+	juce::FileInputStream in(indexFile);
+	if (!in.openedOk())
+		return result;
+
+	Header header;
+	if (in.read(&header, sizeof(Header)) != (int)sizeof(Header)
+		|| std::memcmp(header.magic, "FILTRLIB", 8) != 0
+		|| header.version != kVersion
+		|| header.entrySize != (juce::int32)sizeof(Entry)
+		|| header.numEntries < 0
+		|| in.getTotalLength() < (juce::int64)(sizeof(Header) + (size_t)header.numEntries * sizeof(Entry)))
+	{
+		return result;
+	}
+
+	result.resize((size_t)header.numEntries);
+	auto bytes = result.size() * sizeof(Entry);
+	if (bytes > 0 && (size_t)in.read(result.data(), bytes) != bytes)
+		result.clear();
+
+	return result;
+}
+
+std::vector<PatternLibrary::Entry> PatternLibrary::scanFolder(const juce::File& dir, const std::vector<Entry>& previous,
+	const std::atomic<int>& generation, int gen)
+{
+	std::map<juce::String, std::vector<const Entry*>> indexed;
+	for (auto& e : previous)
+		indexed[juce::String::fromUTF8(e.file, (int)strnlen(e.file, kFileSize))].push_back(&e);
+
+	auto files = dir.findChildFiles(juce::File::findFiles, true, "*.12pat");
+	files.sort();
+
+	std::vector<Entry> result;
+	Pattern scratch(0);
+	for (auto& file : files) {
+		if (generation.load() != gen)
+			break;
+
+		auto rel = file.getRelativePathFrom(dir).replaceCharacter('\\', '/');
+		if ((int)rel.getNumBytesAsUTF8() >= kFileSize)
+			continue; // path does not fit the entry
+
+		auto modified = file.getLastModificationTime().toMilliseconds();
+		auto size = file.getSize();
+
+		// reuse entries of unchanged files, a file without patterns is parsed again on every scan
+		auto it = indexed.find(rel);
+		if (it != indexed.end() && !it->second.empty()
+			&& it->second[0]->modified == modified && it->second[0]->size == size)
+		{
+			for (auto* e : it->second)
+				result.push_back(*e);
+			continue;
+		}
+
+		juce::FileInputStream in(file);
+		if (!in.openedOk())
+			continue;
+
+		for (int line = 0; line < PATTERN_LINES && !in.isExhausted(); ++line) {
+			auto points = FILTRAudioProcessor::parsePoints(in.readNextLine().toStdString());
+			if (points.empty())
+				continue;
+
+			Entry entry = {};
+			rel.copyToUTF8(entry.file, kFileSize);
+			buildTags(rel, line).copyToUTF8(entry.tags, kTagsSize);
+			entry.modified = modified;
+			entry.size = size;
+			entry.line = line;
+			buildEntry(entry, points, scratch);
+			result.push_back(entry);
+		}
+	}
+
+	return result;
+}
+
+void PatternLibrary::buildEntry(Entry& entry, const std::vector<PPoint>& points, Pattern& scratch)
+{
+	scratch.clear();
+	scratch.insertPoints(points);
+	scratch.buildSegments();
+
+	entry.points = (juce::int32)points.size();
+	entry.avgY = (float)scratch.getavgY();
+	for (int i = 0; i < kThumbWidth; ++i) {
+		auto y = scratch.get_y_at((i + 0.5) / kThumbWidth);
+		entry.thumb[i] = (juce::uint8)juce::jlimit(0, 255, (int)std::round(y * 255.0));
+	}
+}
+
+juce::String PatternLibrary::buildTags(const juce::String& relativePath, int line)
+{
+	auto words = juce::StringArray::fromTokens(relativePath.upToLastOccurrenceOf(".", false, false).toLowerCase(), "/ _-.", "");
+	words.removeEmptyStrings();
+	words.removeDuplicates(false);
+	words.add(line < 12 ? "cut" : "res");
+	words.add("p" + juce::String(line % 12 + 1));
+	return words.joinIntoString(" ");
+}
+
+std::string PatternLibrary::readLine(const juce::File& file, int line)
+{
+	juce::FileInputStream in(file);
+	if (!in.openedOk())
+		return {};
+
+	juce::String str;
+	for (int i = 0; i <= line && !in.isExhausted(); ++i)
+		str = in.readNextLine();
+
+	return str.toStdString();
+}
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include <vector>
+#include <memory>
+#include <functional>
+#include <atomic>
+#include "../dsp/Pattern.h"
+#include "SharedThreadPool.h"
+
+/**
+ * PatternLibrary indexes a folder of .12pat files for browsing.
+ * Every non empty pattern line of every file becomes one fixed size entry
+ * holding its point count, tags, average level and a pre-rendered thumbnail.
+ * The entries are stored in an index file inside the library folder which is
+ * memory mapped on the message thread, scanning and pattern loading run on the
+ * process-wide background pool so browsing never blocks on disk.
+ */
+class PatternLibrary : public juce::ChangeBroadcaster
+{
+public:
+    static constexpr int kThumbWidth = 64;
+    static constexpr int kFileSize = 128;
+    static constexpr int kTagsSize = 96;
+    static constexpr int kVersion = 1;
+    static constexpr const char* indexFileName = ".filtr-library.idx";
+
+    struct Header {
+        char magic[8]; // "FILTRLIB"
+        juce::int32 version;
+        juce::int32 entrySize;
+        juce::int64 numEntries;
+    };
+
+    struct Entry {
+        char file[kFileSize]; // utf8 path relative to the library folder
+        char tags[kTagsSize]; // lowercase tags separated by spaces, built from the folders and file name
+        juce::int64 modified; // source file modification time, used to skip unchanged files on rescan
+        juce::int64 size; // source file size
+        juce::int32 line; // pattern line in the file, 0..11 cut patterns, 12..23 res patterns
+        juce::int32 points;
+        float avgY;
+        juce::uint8 thumb[kThumbWidth]; // pattern y sampled across x, 0 is the top
+    };
+
+    PatternLibrary();
+    ~PatternLibrary() override;
+
+    /**
+     * Sets the library folder, maps its existing index and starts a rescan
+     * @param folder Folder containing .12pat files, searched recursively
+     */
+    void setFolder(const juce::File& folder);
+    juce::File getFolder() const { return folder; }
+
+    /**
+     * Rescans the library folder on the background thread
+     * Files with unchanged size and modification time reuse their indexed entries
+     * Listeners are notified on the message thread once the new index is mapped
+     */
+    void rescan();
+    bool isScanning() const { return scanning.load(); }
+
+    /**
+     * Entries are read straight from the mapped index, message thread only
+     * Pointers are valid until the next change message
+     */
+    int getNumEntries() const;
+    const Entry* getEntry(int index) const;
+
+    /**
+     * Returns the indexes of entries matching every word of the query
+     * against their file name and tags, an empty query matches all entries
+     */
+    std::vector<int> search(const juce::String& query) const;
+
+    /**
+     * Reads and parses an entry pattern on the background thread
+     * @param index Entry index
+     * @param callback Called on the message thread with the parsed points
+     */
+    void loadPoints(int index, std::function<void(std::vector<PPoint>)> callback);
+
+private:
+    juce::File folder;
+    std::unique_ptr<juce::MemoryMappedFile> mapped;
+    const Entry* entries = nullptr;
+    int numEntries = 0;
+    std::vector<Entry> memEntries; // index kept in memory when the folder is not writable
+    std::atomic<bool> scanning = false;
+    std::shared_ptr<std::atomic<int>> generation = std::make_shared<std::atomic<int>>(0); // discards scans started for a previous folder, shared with running jobs
+    juce::SharedResourcePointer<SharedThreadPool> pool; // scans and pattern previews, shared by all instances
+
+    void remap();
+    void unmap();
+    static std::vector<Entry> readIndex(const juce::File& indexFile);
+    static std::vector<Entry> scanFolder(const juce::File& folder, const std::vector<Entry>& previous,
+        const std::atomic<int>& generation, int gen);
+    static void buildEntry(Entry& entry, const std::vector<PPoint>& points, Pattern& scratch);
+    static juce::String buildTags(const juce::String& relativePath, int line);
+    static std::string readLine(const juce::File& file, int line);
+
+    JUCE_DECLARE_WEAK_REFERENCEABLE(PatternLibrary)
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PatternLibrary)
+};
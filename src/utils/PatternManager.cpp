@@ -42,6 +42,7 @@ void PatternManager::importPatterns(Pattern* patterns[PATTERN_COUNT],Pattern* re
 					{
 						patterns[i]->insertPoint(x, y, tension, type, false);
 					}
+					patterns[i]->sortPointsSafe(); // files are not trusted to be sorted
 					patterns[i]->setTension(tensionParameters.tension, tensionParameters.tensionAtk, tensionParameters.tensionRel, tensionParameters.dualTension);
 					patterns[i]->buildSegments();
 				}
@@ -63,6 +64,7 @@ void PatternManager::importPatterns(Pattern* patterns[PATTERN_COUNT],Pattern* re
 					{
 						respatterns[i]->insertPoint(x, y, tension, type, false);
 					}
+					respatterns[i]->sortPointsSafe(); // files are not trusted to be sorted
 					respatterns[i]->setTension(tensionParameters.tension, tensionParameters.tensionAtk, tensionParameters.tensionRel, tensionParameters.dualTension);
 					respatterns[i]->buildSegments();
 				}
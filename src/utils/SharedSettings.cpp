@@ -0,0 +1,124 @@
+#include "SharedSettings.h"
+#include "../PluginProcessor.h"
+#include <sstream>
+
+SharedSettings::SharedSettings()
+{
+	juce::PropertiesFile::Options options{};
+	options.applicationName = ProjectInfo::projectName;
+	options.filenameSuffix = ".settings";
+#if defined(JUCE_LINUX) || defined(JUCE_BSD)
+	options.folderName = "~/.config/filtr";
+#endif
+	options.osxLibrarySubFolder = "Application Support";
+	options.storageFormat = juce::PropertiesFile::storeAsXML;
+	properties.setStorageParameters(options);
+
+	parsePaintPatterns();
+	fileTime = getFileTime();
+}
+
+SharedSettings::~SharedSettings()
+{
+	properties.saveIfNeeded();
+}
+
+void SharedSettings::reloadIfChanged()
+{
+	auto time = getFileTime();
+	if (time == fileTime)
+		return;
+
+	properties.closeFiles(); // reopened from disk on next access
+	parsePaintPatterns();
+	fileTime = time;
+	sendChangeMessage();
+}
+
+void SharedSettings::save()
+{
+	properties.saveIfNeeded();
+	fileTime = getFileTime();
+}
+
+juce::String SharedSettings::getValue(const juce::String& key, const juce::String& defaultValue) const
+{
+	auto* file = properties.getUserSettings();
+	return file != nullptr ? file->getValue(key, defaultValue) : defaultValue;
+}
+
+int SharedSettings::getIntValue(const juce::String& key, int defaultValue) const
+{
+	auto* file = properties.getUserSettings();
+	return file != nullptr ? file->getIntValue(key, defaultValue) : defaultValue;
+}
+
+double SharedSettings::getDoubleValue(const juce::String& key, double defaultValue) const
+{
+	auto* file = properties.getUserSettings();
+	return file != nullptr ? file->getDoubleValue(key, defaultValue) : defaultValue;
+}
+
+void SharedSettings::setValue(const juce::String& key, const juce::var& value)
+{
+	if (auto* file = properties.getUserSettings())
+		file->setValue(key, value);
+}
+
+SharedSettings::Points SharedSettings::getPaintPattern(int index) const
+{
+	std::lock_guard<std::mutex> lock(mtx);
+	return paintPatterns[index];
+}
+
+SharedSettings::Points SharedSettings::setPaintPattern(int index, const std::vector<PPoint>& points)
+{
+	{
+		std::lock_guard<std::mutex> lock(mtx);
+		auto& current = paintPatterns[index];
+		if (current != nullptr && samePoints(*current, points))
+			return current;
+
+		current = std::make_shared<const std::vector<PPoint>>(points);
+	}
+
+	std::ostringstream oss;
+	for (const auto& point : points) {
+		oss << point.x << " " << point.y << " " << point.tension << " " << point.type << " ";
+	}
+	setValue("paintpat" + juce::String(index), juce::var(oss.str()));
+	sendChangeMessage();
+	return getPaintPattern(index);
+}
+
+// unchanged patterns keep their shared set so instances do not reinstall them
+void SharedSettings::parsePaintPatterns()
+{
+	auto* file = properties.getUserSettings();
+	std::lock_guard<std::mutex> lock(mtx);
+	for (int i = 0; i < globals::PAINT_PATS; ++i) {
+		auto str = file != nullptr ? file->getValue("paintpat" + juce::String(i), "").toStdString() : "";
+		if (str.empty()) {
+			paintPatterns[i] = nullptr;
+			continue;
+		}
+
+		auto points = FILTRAudioProcessor::parsePoints(str);
+		if (paintPatterns[i] == nullptr || !samePoints(*paintPatterns[i], points))
+			paintPatterns[i] = std::make_shared<const std::vector<PPoint>>(std::move(points));
+	}
+}
+
+bool SharedSettings::samePoints(const std::vector<PPoint>& a, const std::vector<PPoint>& b)
+{
+	return a.size() == b.size()
+		&& std::equal(a.begin(), a.end(), b.begin(), [](const PPoint& p, const PPoint& q) {
+			return p.x == q.x && p.y == q.y && p.tension == q.tension && p.type == q.type;
+		});
+}
+
+juce::Time SharedSettings::getFileTime()
+{
+	auto* file = properties.getUserSettings();
+	return file != nullptr ? file->getFile().getLastModificationTime() : juce::Time();
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include "../dsp/Pattern.h"
+#include "../Globals.h"
+
+/**
+ * SharedSettings holds the user settings shared by all plugin instances in the process.
+ * It is acquired through juce::SharedResourcePointer, the settings file is read by the
+ * first instance and released with the last one. Paint patterns are parsed once and handed
+ * out as immutable shared point sets, publishing a pattern replaces its set (copy-on-write)
+ * and notifies the other instances through a change message.
+ */
+class SharedSettings : public juce::ChangeBroadcaster
+{
+public:
+    using Points = std::shared_ptr<const std::vector<PPoint>>;
+
+    SharedSettings();
+    ~SharedSettings() override;
+
+    /**
+     * Reads the settings file again if it was modified by another process
+     * Instances in this process never need this, their changes are shared in memory
+     */
+    void reloadIfChanged();
+
+    /**
+     * Writes pending changes to disk
+     */
+    void save();
+
+    juce::String getValue(const juce::String& key, const juce::String& defaultValue = {}) const;
+    int getIntValue(const juce::String& key, int defaultValue) const;
+    double getDoubleValue(const juce::String& key, double defaultValue) const;
+    void setValue(const juce::String& key, const juce::var& value);
+
+    /**
+     * Returns the saved points of a paint pattern, nullptr if it was never saved
+     * @param index Paint pattern index
+     */
+    Points getPaintPattern(int index) const;
+
+    /**
+     * Publishes the points of a paint pattern, the shared set is only replaced if the points changed
+     * @param index Paint pattern index
+     * @param points Pattern points, ids are ignored when comparing
+     * @return The current shared set of the pattern
+     */
+    Points setPaintPattern(int index, const std::vector<PPoint>& points);
+
+private:
+    mutable juce::ApplicationProperties properties;
+    mutable std::mutex mtx;
+    Points paintPatterns[globals::PAINT_PATS];
+    juce::Time fileTime; // settings file modification time when last read or written
+
+    void parsePaintPatterns();
+    static bool samePoints(const std::vector<PPoint>& a, const std::vector<PPoint>& b); // ids are ignored
+    juce::Time getFileTime();
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SharedSettings)
+};
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <JuceHeader.h>
+
+/**
+ * Background pool shared by all plugin instances in the process, acquired through
+ * juce::SharedResourcePointer. Used for short jobs like parsing restored state and
+ * scanning the pattern library, jobs must not capture raw instance pointers since
+ * the instance that queued them may be gone when they run.
+ */
+class SharedThreadPool
+{
+public:
+    juce::ThreadPool pool { 2 };
+};